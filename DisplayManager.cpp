@@ -1,8 +1,8 @@
 #include "DisplayManager.h"
 
-// O construtor usa uma lista de inicialização para configurar o objeto u8g2.
+// O construtor usa uma lista de inicialização para guardar a referência ao u8g2.
 // Isso é mais eficiente do que atribuir valores dentro das chaves {}.
-DisplayManager::DisplayManager() : u8g2(U8G2_R0, /* reset=*/ U8X8_PIN_NONE) {
+DisplayManager::DisplayManager(U8G2& display) : u8g2(display) {
   // O corpo do construtor pode ficar vazio se toda a inicialização
   // for feita na lista de inicialização.
 }
@@ -17,6 +17,11 @@ void DisplayManager::setBrightness(uint8_t brightness) {
   u8g2.setContrast(brightness);
 }
 
+void DisplayManager::setPowerSave(bool enabled) {
+  // No SSD1306 isso desliga o painel (comando 0xAE/0xAF); a RAM da tela é mantida.
+  u8g2.setPowerSave(enabled ? 1 : 0);
+}
+
 void DisplayManager::clear() {
     u8g2.clearBuffer();
     u8g2.sendBuffer();
@@ -24,43 +29,132 @@ void DisplayManager::clear() {
 
 void DisplayManager::showActivityScreen(const char* activityName) {
     u8g2.clearBuffer();
-    u8g2.setFont(u8g2_font_7x13B_tr); // Usando uma fonte um pouco maior para destaque
 
-    // Calcula a posição X para centralizar o texto
-    u8g2_uint_t textWidth = u8g2.getStrWidth(activityName);
-    u8g2_uint_t x = (SCREEN_WIDTH - textWidth) / 2;
+    // Centraliza na horizontal; na vertical usa a página 3 (y = 24), que fica
+    // no meio da tela e mantém o caminho rápido do atlas.
+    int x = (SCREEN_WIDTH - textWidth(activityName)) / 2;
+    drawText(x, 24, activityName);
+
+    u8g2.sendBuffer();
+}
+
+void DisplayManager::showProgress(const char* title, int percent) {
+    percent = constrain(percent, 0, 100);
+
+    u8g2.clearBuffer();
+    drawText(0, 0, title);
+
+    // Moldura da barra e preenchimento proporcional ao progresso
+    u8g2.drawFrame(0, 24, SCREEN_WIDTH, 14);
+    u8g2.drawBox(2, 26, (SCREEN_WIDTH - 4) * percent / 100, 10);
 
-    // Calcula a posição Y para centralizar o texto
-    u8g2_uint_t y = (SCREEN_HEIGHT / 2) + 4; // Um pequeno ajuste para centralizar verticalmente
+    char percentText[8];
+    snprintf(percentText, sizeof(percentText), "%d%%", percent);
+    drawText((SCREEN_WIDTH - textWidth(percentText)) / 2, 48, percentText);
 
-    u8g2.drawStr(x, y, activityName);
     u8g2.sendBuffer();
 }
 
-void DisplayManager::drawMenu(const char* menuItems[], int totalItems, int selectedItem) {
+void DisplayManager::drawMenu(const char* menuItems[], int totalItems, int selectedItem, const AtlasIconId menuIcons[]) {
   // 1. Limpa a memória (buffer) do display antes de desenhar algo novo.
   u8g2.clearBuffer();
-  u8g2.setFont(u8g2_font_6x10_tf); // Define a fonte para o menu
 
-  for (int i = 0; i < totalItems; i++) {
-    int yPosition = 12 + i * 13; // Calcula a posição Y para cada item
+  // Rola a lista quando o item selecionado passaria da última linha visível
+  const int visibleRows = SCREEN_HEIGHT / 16;
+  int firstItem = max(0, selectedItem - visibleRows + 1);
+  // Com ícones, o texto e o destaque começam depois da coluna de ícones
+  const int textX = menuIcons ? 20 : 2;
 
-    // 2. Verifica se o item atual é o que está selecionado
-    if (i == selectedItem) {
-      // Desenha uma caixa preenchida para destacar o item selecionado
-      u8g2.drawBox(0, yPosition - 9, SCREEN_WIDTH, 12); 
-      // Define a cor de desenho para "transparente" (ou cor de fundo),
-      // para que o texto apareça sobre a caixa preenchida.
-      u8g2.setDrawColor(0); 
+  for (int i = firstItem; i < totalItems && i < firstItem + visibleRows; i++) {
+    // Cada item ocupa 16 pixels; o texto fica em uma página inteira (y múltiplo de 8)
+    int yPosition = 8 + (i - firstItem) * 16;
+
+    // 2. O ícone ocupa as duas páginas da linha (y múltiplo de 16)
+    if (menuIcons) {
+      drawIcon(0, yPosition - 8, menuIcons[i]);
     }
 
-    // 3. Desenha o texto do item do menu
-    u8g2.drawStr(2, yPosition, menuItems[i]);
+    // 3. Verifica se o item atual é o que está selecionado
+    bool selected = (i == selectedItem);
+    if (selected) {
+      // Desenha uma caixa preenchida para destacar o item selecionado
+      u8g2.drawBox(textX - 2, yPosition - 2, SCREEN_WIDTH - (textX - 2), 10);
+    }
 
-    // 4. Restaura a cor de desenho padrão para o próximo item
-    u8g2.setDrawColor(1);
+    // 4. Desenha o texto do item do menu (invertido sobre a caixa de destaque)
+    drawText(textX, yPosition, menuItems[i], selected);
   }
 
   // 5. Envia o conteúdo do buffer para a tela do display físico.
   u8g2.sendBuffer();
+}
+
+int DisplayManager::drawText(int x, int y, const char* text, bool inverted) {
+  return blitText(u8g2, x, y, text, inverted);
+}
+
+void DisplayManager::drawIcon(int x, int y, AtlasIconId icon) {
+  blitIcon(u8g2, x, y, icon);
+}
+
+int DisplayManager::textWidth(const char* text) {
+  int length = strlen(text);
+  // Cada glifo ocupa ATLAS_GLYPH_WIDTH colunas + 1 coluna de espaçamento
+  return length > 0 ? length * (ATLAS_GLYPH_WIDTH + 1) - 1 : 0;
+}
+
+void DisplayManager::blitColumn(U8G2& target, int x, int y, uint8_t bits) {
+  int width = target.getBufferTileWidth() * 8;
+  int pages = target.getBufferTileHeight();
+  if (x < 0 || x >= width) return;
+
+  uint8_t* buffer = target.getBufferPtr();
+  int page = y >> 3;   // Página (linha de 8 pixels) onde o byte começa
+  int shift = y & 7;   // Deslocamento dentro da página
+
+  // Caminho rápido: alinhado à página, o byte do atlas é o byte do buffer.
+  if (shift == 0) {
+    if (page >= 0 && page < pages) buffer[page * width + x] = bits;
+    return;
+  }
+
+  if (page >= 0 && page < pages) {
+    uint8_t& upper = buffer[page * width + x];
+    upper = (upper & ~(0xFF << shift)) | (bits << shift);
+  }
+  if (page + 1 >= 0 && page + 1 < pages) {
+    uint8_t& lower = buffer[(page + 1) * width + x];
+    lower = (lower & ~(0xFF >> (8 - shift))) | (bits >> (8 - shift));
+  }
+}
+
+int DisplayManager::blitText(U8G2& target, int x, int y, const char* text, bool inverted) {
+  uint8_t mask = inverted ? 0xFF : 0x00;
+
+  for (const char* c = text; *c; c++) {
+    uint8_t ch = (uint8_t)*c;
+    if (ch < ATLAS_FIRST_CHAR || ch > ATLAS_LAST_CHAR) ch = '?';
+    const uint8_t* glyph = &ATLAS_DATA[(ch - ATLAS_FIRST_CHAR) * ATLAS_GLYPH_WIDTH];
+
+    for (int col = 0; col < ATLAS_GLYPH_WIDTH; col++) {
+      blitColumn(target, x++, y, pgm_read_byte(&glyph[col]) ^ mask);
+    }
+    // Coluna de espaçamento entre os caracteres (não depois do último)
+    if (c[1]) blitColumn(target, x++, y, mask);
+  }
+  return x;
+}
+
+void DisplayManager::blitIcon(U8G2& target, int x, int y, AtlasIconId icon) {
+  if (icon >= ATLAS_ICON_COUNT) return;
+
+  AtlasIcon entry;
+  memcpy_P(&entry, &ATLAS_ICONS[icon], sizeof(entry));
+  const uint8_t* data = &ATLAS_DATA[entry.offset];
+
+  for (int page = 0; page < entry.pages; page++) {
+    for (int col = 0; col < entry.width; col++) {
+      blitColumn(target, x + col, y + page * 8, pgm_read_byte(&data[page * entry.width + col]));
+    }
+  }
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 
 #include <Arduino.h>
 #include <U8g2lib.h>
+#include "atlas.h" // Glifos e ícones pré-empacotados no formato de página do SSD1306
 
 // Definindo as dimensões da tela aqui para que o DisplayManager as conheça
 #define SCREEN_WIDTH 128
@@ -12,9 +13,9 @@ class DisplayManager {
 public:
     /**
      * @brief Construtor da classe DisplayManager.
-     *        Inicializa o objeto u8g2 com a rotação e pino de reset corretos.
+     * @param display O objeto U8G2 do OLED, compartilhado com os módulos (o `u8g2` global).
      */
-    DisplayManager();
+    DisplayManager(U8G2& display);
 
     /**
      * @brief Inicializa a comunicação com o display e define o brilho inicial.
@@ -29,12 +30,20 @@ public:
     void setBrightness(uint8_t brightness);
 
     /**
-     * @brief Desenha o menu principal na tela.
+     * @brief Liga ou desliga o painel OLED sem perder o conteúdo do buffer.
+     * @param enabled true para apagar a tela (modo de economia do SSD1306).
+     */
+    void setPowerSave(bool enabled);
+
+    /**
+     * @brief Desenha o menu principal na tela. Cabem SCREEN_HEIGHT / 16 itens;
+     *        com mais itens a lista rola para manter o selecionado visível.
      * @param menuItems Array de strings com os nomes dos itens do menu.
      * @param totalItems O número total de itens no menu.
      * @param selectedItem O índice do item atualmente selecionado.
+     * @param menuIcons Ícone 16x16 de cada item, desenhado à esquerda do texto (opcional).
      */
-    void drawMenu(const char* menuItems[], int totalItems, int selectedItem);
+    void drawMenu(const char* menuItems[], int totalItems, int selectedItem, const AtlasIconId menuIcons[] = nullptr);
     
     /**
      * @brief Mostra uma tela de "atividade" para indicar que uma função está em execução.
@@ -42,15 +51,61 @@ public:
      */
     void showActivityScreen(const char* activityName);
 
+    /**
+     * @brief Mostra uma barra de progresso com título e porcentagem.
+     * @param title O texto exibido acima da barra (ex: "Updating...").
+     * @param percent O progresso atual, de 0 a 100.
+     */
+    void showProgress(const char* title, int percent);
+
     /**
      * @brief Limpa o buffer do display.
      */
     void clear();
 
+    /**
+     * @brief Escreve um texto no buffer usando os glifos 5x7 do atlas.
+     * @param x Coluna inicial (em pixels).
+     * @param y Linha do topo do texto (em pixels). Múltiplos de 8 usam o caminho rápido.
+     * @param text O texto a ser escrito (caracteres fora do atlas viram '?').
+     * @param inverted Se true, escreve o texto apagado sobre fundo aceso.
+     * @return A coluna logo após o último caractere.
+     */
+    int drawText(int x, int y, const char* text, bool inverted = false);
+
+    /**
+     * @brief Escreve um ícone do atlas no buffer.
+     * @param x Coluna inicial (em pixels).
+     * @param y Linha do topo do ícone (em pixels). Múltiplos de 8 usam o caminho rápido.
+     * @param icon O ícone a ser desenhado.
+     */
+    void drawIcon(int x, int y, AtlasIconId icon);
+
+    /**
+     * @brief Versões estáticas de drawText/drawIcon para quem desenha direto em um
+     *        objeto U8G2 (ex: o `u8g2` global usado pelos módulos).
+     *        Copiam os bytes do atlas direto no buffer de páginas, sem setFont nem
+     *        decodificação de fonte; só o sendBuffer() continua por conta de quem chama.
+     */
+    static int blitText(U8G2& target, int x, int y, const char* text, bool inverted = false);
+    static void blitIcon(U8G2& target, int x, int y, AtlasIconId icon);
+
+    /**
+     * @brief Largura em pixels de um texto desenhado com drawText/blitText.
+     */
+    static int textWidth(const char* text);
+
 private:
-    // O objeto da biblioteca U8G2 é agora um membro privado da classe.
-    // Ninguém fora desta classe pode acessá-lo diretamente.
-    U8G2_SSD1306_128X64_NONAME_F_HW_I2C u8g2;
+    // O objeto da biblioteca U8G2 é o `u8g2` global do .ino, o mesmo em que os
+    // módulos desenham; esta classe é quem o inicia (begin) e controla o brilho.
+    U8G2& u8g2;
+
+    /**
+     * @brief Substitui 8 pixels verticais a partir de (x, y) no buffer de páginas.
+     *        Com y alinhado a 8 é uma única escrita de byte; senão, divide o byte
+     *        entre as duas páginas envolvidas.
+     */
+    static void blitColumn(U8G2& target, int x, int y, uint8_t bits);
 };
 
 #endif // DISPLAY_MANAGER_H
\ No newline at end of file
@@ -3,7 +3,7 @@
 // Inicializa o array estático de instâncias.
 // Usamos a mesma diretiva de compilação condicional do .h
 #if defined(ESP32)
-    Encoder* Encoder::_instances[XCHAL_NUM_INTERRUPTS] = { nullptr };
+    Encoder* Encoder::_instances[SOC_GPIO_PIN_COUNT] = { nullptr };
 #else
     Encoder* Encoder::_instances[CORE_NUM_INTERRUPT] = { nullptr };
 #endif
@@ -66,4 +66,10 @@ void IRAM_ATTR Encoder::_isrPinB() {
 void IRAM_ATTR Encoder::_update() {
     _state = (_state << 2) | (digitalRead(_pinA) << 1) | digitalRead(_pinB);
     _position += KNOBDIR[_state & 0x0F];
-}
\ No newline at end of file
+}
+
+void Encoder::resync() {
+    noInterrupts(); // Não deixa uma ISR intercalar com a leitura dos pinos
+    _update();
+    interrupts();
+}
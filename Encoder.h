@@ -1,94 +1,55 @@
+#ifndef ENCODER_H
+#define ENCODER_H
 
+#include <Arduino.h>
+#if defined(ESP32)
+#include <soc/soc_caps.h> // SOC_GPIO_PIN_COUNT
+#endif
 
-// Inicializa o array estático de ponteiros para as instâncias do Encoder
+// Encoder rotativo em quadratura lido por interrupção (CHANGE nos dois pinos).
+class Encoder {
+public:
+    /**
+     * @brief Configura os pinos com pull-up e anexa as interrupções.
+     * @param pinA Fase A do encoder.
+     * @param pinB Fase B do encoder.
+     */
+    Encoder(uint8_t pinA, uint8_t pinB);
+
+    /**
+     * @brief Retorna a posição acumulada (4 passos por clique na maioria dos encoders).
+     */
+    long read();
+
+    /**
+     * @brief Redefine a posição acumulada.
+     */
+    void write(long newPosition);
+
+    /**
+     * @brief Processa o nível atual dos pinos como se uma borda tivesse chegado.
+     *        Usado depois de um período com as interrupções desligadas (ex: light
+     *        sleep), cuja borda que acordou o CPU nunca chegou à ISR.
+     */
+    void resync();
+
+private:
+    uint8_t _pinA;
+    uint8_t _pinB;
+    volatile long _position;
+    volatile uint8_t _state;
+
+    // Instância dona de cada interrupção, para as ISRs estáticas chegarem ao objeto.
+    // No ESP32 o número da interrupção é o próprio GPIO (até 39), não uma das 32 da CPU.
 #if defined(ESP32)
-    Encoder* Encoder::_instances[XCHAL_NUM_INTERRUPTS] = { nullptr };
+    static Encoder* _instances[SOC_GPIO_PIN_COUNT];
 #else
-    Encoder* Encoder::_instances[16] = { nullptr };
+    static Encoder* _instances[CORE_NUM_INTERRUPT];
 #endif
 
-// Construtor
-Encoder::Encoder(uint8_t pinA, uint8_t pinB) {
-    _pinA = pinA;
-    _pinB = pinB;
-    _position = 0;
-    _state = 0;
-
-    pinMode(_pinA, INPUT_PULLUP);
-    pinMode(_pinB, INPUT_PULLUP);
-
-    // Lê o estado inicial
-    if (digitalRead(_pinA)) _state |= 1;
-    if (digitalRead(_pinB)) _state |= 2;
-    
-    // Converte o número do pino para um número de interrupção
-    int8_t interruptA = digitalPinToInterrupt(_pinA);
-    int8_t interruptB = digitalPinToInterrupt(_pinB);
-
-    if (interruptA != NOT_AN_INTERRUPT) {
-        // Armazena o ponteiro 'this' no array estático na posição da interrupção
-        _instances[interruptA] = this;
-        // Anexa a função ISR estática
-        attachInterrupt(interruptA, _isrPinA, CHANGE);
-    }
-    
-    if (interruptB != NOT_AN_INTERRUPT) {
-        _instances[interruptB] = this;
-        attachInterrupt(interruptB, _isrPinB, CHANGE);
-    }
-}
-
-// Função de atualização chamada pelas ISRs estáticas
-void IRAM_ATTR Encoder::_update() {
-    uint8_t s = _state & 3;
-    if (digitalRead(_pinA)) s |= 4;
-    if (digitalRead(_pinB)) s |= 8;
-    
-    switch (s) {
-        case 0: case 5: case 10: case 15:
-            break;
-        case 1: case 7: case 8: case 14:
-            _position++; break;
-        case 2: case 4: case 11: case 13:
-            _position--; break;
-        case 3: case 12:
-            _position += 2; break;
-        default:
-            _position -= 2; break;
-    }
-    _state = (s >> 2);
-}
-
-// ISR Estática para o pino A
-void IRAM_ATTR Encoder::_isrPinA() {
-    // Como não sabemos qual pino gerou a interrupção no ESP32,
-    // precisamos chamar o update de todas as instâncias.
-    // Uma abordagem mais otimizada seria verificar o pino, mas isso é mais complexo.
-    // Para a maioria dos casos com poucos encoders, esta abordagem funciona bem.
-    for (uint8_t i = 0; i < (sizeof(_instances) / sizeof(_instances[0])); ++i) {
-        if (_instances[i] != nullptr) {
-            _instances[i]->_update();
-        }
-    }
-}
-
-// ISR Estática para o pino B
-void IRAM_ATTR Encoder::_isrPinB() {
-    // Chama a mesma lógica da ISR do pino A
-    _isrPinA();
-}
-
-long Encoder::read() {
-    // Desabilita interrupções temporariamente para ler a variável de forma atômica
-    noInterrupts();
-    long ret = _position;
-    interrupts();
-    return ret;
-}
+    static void _isrPinA();
+    static void _isrPinB();
+    void _update();
+};
 
-void Encoder::write(long newPosition) {
-    // Desabilita interrupções temporariamente para escrever na variável de forma atômica
-    noInterrupts();
-    _position = newPosition;
-    interrupts();
-}
\ No newline at end of file
+#endif // ENCODER_H
@@ -0,0 +1,47 @@
+#ifndef MODULE_REGISTRY_H
+#define MODULE_REGISTRY_H
+
+#include "config.h"
+#include "atlas.h" // AtlasIconId
+
+// Descreve um módulo de aplicação (par setup/loop) que pode ser aberto pelo menu.
+struct ModuleEntry {
+    const char* name;
+    void (*setup)();
+    void (*loop)();
+    void (*stop)();  // Opcional (nullptr): desliga o hardware do módulo ao sair
+    bool transmits; // true para módulos que emitem RF (jammers, spoofers, deauther)
+    AtlasIconId icon; // Ícone mostrado ao lado do nome no menu
+};
+
+// Registro de módulos do perfil ativo, usado pelo menu para listar e abrir os
+// módulos. A exclusão de código é feita pelos #if de feature_flags.h nos .cpp;
+// esta tabela só acompanha as mesmas flags para não referenciar o que não existe.
+constexpr ModuleEntry MODULES[] = {
+#if FEATURE_NRF24_RX
+    {"Analyzer",   Analyzer::analyzerSetup,   Analyzer::analyzerLoop,   Analyzer::analyzerStop, false, ATLAS_ICON_SATELITE},
+#endif
+#if FEATURE_WIFI_RX
+    {"WiFi Scan",  WifiScan::wifiscanSetup,   WifiScan::wifiscanLoop,   nullptr,                false, ATLAS_ICON_WIFI},
+#endif
+#if FEATURE_BLE_RX
+    {"BLE Scan",   BleScan::blescanSetup,     BleScan::blescanLoop,     nullptr,                false, ATLAS_ICON_BLUETOOTH},
+#endif
+#if FEATURE_NRF24_TX
+    {"Jammer",     Jammer::jammerSetup,       Jammer::jammerLoop,       nullptr,                true,  ATLAS_ICON_JAMMER},
+#endif
+#if FEATURE_BLE_TX && FEATURE_NRF24_TX
+    {"BLE Jammer", BleJammer::blejammerSetup, BleJammer::blejammerLoop, nullptr,                true,  ATLAS_ICON_JAMMER},
+#endif
+#if FEATURE_BLE_TX
+    {"Sour Apple", SourApple::sourappleSetup, SourApple::sourappleLoop, nullptr,                true,  ATLAS_ICON_BLUETOOTH},
+    {"Spoofer",    Spoofer::spooferSetup,     Spoofer::spooferLoop,     nullptr,                true,  ATLAS_ICON_BLUETOOTH},
+#endif
+#if FEATURE_WIFI_TX
+    {"Deauther",   Deauther::deautherSetup,   Deauther::deautherLoop,   nullptr,                true,  ATLAS_ICON_DEAUTHER},
+#endif
+};
+
+constexpr int MODULE_COUNT = sizeof(MODULES) / sizeof(MODULES[0]);
+
+#endif // MODULE_REGISTRY_H
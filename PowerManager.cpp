@@ -0,0 +1,216 @@
+#include "PowerManager.h"
+
+#include <esp_sleep.h>
+#include <esp_timer.h>
+#include <driver/gpio.h>
+#include "ModuleRegistry.h" // ModuleEntry e os pinos/bibliotecas de rádio do perfil
+
+PowerManager::PowerManager(DisplayManager& display, SettingManager& settings)
+    : display(display), settings(settings), activeModule(nullptr), modulePaused(false),
+      displayState(DISPLAY_ON), lastActivityTime(0), wakePinCount(0), wakeCallback(nullptr),
+      statsStart(0), sleptMicros(0), timerWakeups(0), gpioWakeups(0),
+      latencyTotal(0), latencyMax(0), inputLatencyTotal(0), inputLatencyMax(0) {}
+
+void PowerManager::addWakePin(uint8_t pin, bool hasEdgeIsr) {
+    if (wakePinCount >= POWER_MAX_WAKE_PINS) return;
+    wakePins[wakePinCount] = pin;
+    wakePinHasIsr[wakePinCount] = hasEdgeIsr;
+    wakePinCount++;
+}
+
+void PowerManager::setWakeCallback(void (*callback)()) {
+    wakeCallback = callback;
+}
+
+void PowerManager::init() {
+    powerDownRadios();
+    lastActivityTime = millis();
+    statsStart = esp_timer_get_time();
+}
+
+void PowerManager::setActiveModule(const ModuleEntry* module) {
+    if (activeModule && activeModule != module && activeModule->stop && !modulePaused) {
+        activeModule->stop();
+    }
+    activeModule = module;
+    modulePaused = false;
+
+    if (!activeModule) {
+        powerDownRadios();
+    }
+}
+
+void PowerManager::notifyActivity() {
+    lastActivityTime = millis();
+
+    if (displayState != DISPLAY_ON) {
+        display.setPowerSave(false);
+        display.setBrightness(settings.getBrightness());
+        displayState = DISPLAY_ON;
+    }
+
+    // Retoma o módulo que foi pausado enquanto ninguém olhava a tela
+    if (modulePaused) {
+        modulePaused = false;
+        activeModule->setup();
+    }
+}
+
+bool PowerManager::isModulePaused() {
+    return modulePaused;
+}
+
+bool PowerManager::isDisplayOff() {
+    return displayState == DISPLAY_OFF;
+}
+
+void PowerManager::updateDisplayPower() {
+    unsigned long inactive = millis() - lastActivityTime;
+
+    if (displayState == DISPLAY_ON && inactive >= POWER_DIM_TIMEOUT_MS) {
+        // Escurece para 1/4 do brilho salvo pelo usuário
+        display.setBrightness(settings.getBrightness() / 4);
+        displayState = DISPLAY_DIMMED;
+    }
+
+    if (displayState == DISPLAY_DIMMED && inactive >= POWER_OFF_TIMEOUT_MS) {
+        display.setPowerSave(true);
+        displayState = DISPLAY_OFF;
+
+        // Módulos que sabem parar (ex: Analyzer) não precisam varrer com a tela apagada
+        if (activeModule && activeModule->stop) {
+            activeModule->stop();
+            modulePaused = true;
+        }
+    }
+}
+
+void PowerManager::idle(uint32_t tickMs) {
+    updateDisplayPower();
+
+    // Com um rádio em uso o light sleep derrubaria o link; o módulo controla o próprio ritmo.
+    if (activeModule && !modulePaused) return;
+
+    uint32_t sleepMs = (displayState == DISPLAY_OFF) ? POWER_BLANK_TICK_MS : tickMs;
+    if (wakePinCount == 0) {
+        // Sem pinos de despertar, só o timer acordaria: um delay mantém a resposta à entrada.
+        delay(tickMs);
+        return;
+    }
+    lightSleep(sleepMs);
+}
+
+void PowerManager::lightSleep(uint32_t sleepMs) {
+    // O wakeup por GPIO é por nível: acorda quando o pino sair do nível atual.
+    // gpio_wakeup_enable troca o tipo da interrupção do pino para nível; com a ISR do
+    // encoder ainda habilitada ela dispararia sem parar (e o watchdog reiniciaria o chip).
+    for (uint8_t i = 0; i < wakePinCount; i++) {
+        gpio_num_t pin = (gpio_num_t)wakePins[i];
+        if (wakePinHasIsr[i]) {
+            gpio_intr_disable(pin);
+        }
+        gpio_wakeup_enable(pin, digitalRead(wakePins[i]) ? GPIO_INTR_LOW_LEVEL : GPIO_INTR_HIGH_LEVEL);
+    }
+    esp_sleep_enable_gpio_wakeup();
+    esp_sleep_enable_timer_wakeup((uint64_t)sleepMs * 1000);
+
+    Serial.flush(); // A UART para durante o sono; evita cortar mensagens pela metade
+
+    int64_t before = esp_timer_get_time();
+    esp_light_sleep_start();
+    int64_t woke = esp_timer_get_time();
+    int64_t slept = woke - before;
+
+    esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_ALL);
+    for (uint8_t i = 0; i < wakePinCount; i++) {
+        gpio_num_t pin = (gpio_num_t)wakePins[i];
+        gpio_wakeup_disable(pin);
+        // Devolve a interrupção por borda (CHANGE) do encoder e a religa
+        if (wakePinHasIsr[i]) {
+            gpio_set_intr_type(pin, GPIO_INTR_ANYEDGE);
+            gpio_intr_enable(pin);
+        } else {
+            gpio_set_intr_type(pin, GPIO_INTR_DISABLE);
+        }
+    }
+
+    // A borda que acordou o CPU aconteceu com a ISR desligada
+    if (wakeCallback) {
+        wakeCallback();
+    }
+
+    sleptMicros += slept;
+    if (esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_TIMER) {
+        // Quanto passou do tempo pedido = custo de entrar/sair do sono
+        int64_t latency = slept - (int64_t)sleepMs * 1000;
+        if (latency < 0) latency = 0;
+        latencyTotal += latency;
+        if (latency > latencyMax) latencyMax = (uint32_t)latency;
+        timerWakeups++;
+    } else {
+        // Do CPU acordado até a entrada estar pronta para o loop (interrupções
+        // restauradas e a borda que acordou já contada pelo callback)
+        uint32_t latency = (uint32_t)(esp_timer_get_time() - woke);
+        inputLatencyTotal += latency;
+        if (latency > inputLatencyMax) inputLatencyMax = latency;
+        gpioWakeups++;
+    }
+}
+
+void PowerManager::powerDownRadios() {
+#if FEATURE_NRF24_RX || FEATURE_NRF24_TX
+    // CE baixo + CONFIG com PWR_UP = 0 (0x08 é o valor de reset) em cada nRF24.
+    // O static_assert de config.h garante que nenhum destes pinos é botão, encoder ou CS do SD.
+    const uint8_t cePins[]  = { NRF_CE_PIN_A, NRF_CE_PIN_B, NRF_CE_PIN_C };
+    const uint8_t csnPins[] = { NRF_CSN_PIN_A, NRF_CSN_PIN_B, NRF_CSN_PIN_C };
+
+    SPI.begin();
+    for (int i = 0; i < 3; i++) {
+        pinMode(cePins[i], OUTPUT);
+        pinMode(csnPins[i], OUTPUT);
+        digitalWrite(cePins[i], LOW);
+
+        digitalWrite(csnPins[i], LOW);
+        SPI.transfer(0x20); // Comando de escrita no registrador CONFIG
+        SPI.transfer(0x08);
+        digitalWrite(csnPins[i], HIGH);
+    }
+#endif
+#if FEATURE_WIFI_STACK
+    WiFi.mode(WIFI_OFF);
+#endif
+#if FEATURE_BLE_STACK
+    // btStop() só pararia o controlador: o Bluedroid seguiria ativo e o BLEDevice
+    // continuaria marcado como iniciado, então o próximo BLEDevice::init() não faria nada.
+    // Só há o que desligar se um módulo BLE chegou a iniciar a pilha.
+    if (BLEDevice::getInitialized()) {
+        BLEDevice::deinit(false); // false: mantém a memória para o próximo init()
+    }
+#endif
+}
+
+void PowerManager::report() {
+    uint64_t now = esp_timer_get_time();
+    uint64_t window = now - statsStart;
+    if (window == 0) return;
+
+    float duty = 100.0f * (float)(window - sleptMicros) / (float)window;
+    uint32_t latencyAvg = timerWakeups ? (uint32_t)(latencyTotal / timerWakeups) : 0;
+    uint32_t inputLatencyAvg = gpioWakeups ? (uint32_t)(inputLatencyTotal / gpioWakeups) : 0;
+
+    Serial.printf("Energia: %.1f%% acordado, %u wakes (timer %u, entrada %u)\n",
+                  duty, (unsigned)(timerWakeups + gpioWakeups), (unsigned)timerWakeups,
+                  (unsigned)gpioWakeups);
+    Serial.printf("  atraso do timer: media %u us (max %u us); resposta a entrada: media %u us (max %u us)\n",
+                  (unsigned)latencyAvg, (unsigned)latencyMax,
+                  (unsigned)inputLatencyAvg, (unsigned)inputLatencyMax);
+
+    statsStart = now;
+    sleptMicros = 0;
+    timerWakeups = 0;
+    gpioWakeups = 0;
+    latencyTotal = 0;
+    latencyMax = 0;
+    inputLatencyTotal = 0;
+    inputLatencyMax = 0;
+}
@@ -0,0 +1,130 @@
+#ifndef POWER_MANAGER_H
+#define POWER_MANAGER_H
+
+#include <Arduino.h>
+#include "DisplayManager.h"
+#include "SettingManager.h"
+
+struct ModuleEntry;
+
+// Tempos de inatividade (sem entrada do usuário) até escurecer e apagar o OLED.
+#define POWER_DIM_TIMEOUT_MS   15000
+#define POWER_OFF_TIMEOUT_MS   60000
+
+// Intervalo máximo de sono com a tela apagada: só a entrada do usuário importa.
+#define POWER_BLANK_TICK_MS    1000
+
+// Número máximo de pinos que podem acordar o CPU do light sleep.
+#define POWER_MAX_WAKE_PINS    8
+
+class PowerManager {
+public:
+    /**
+     * @brief Construtor da classe PowerManager.
+     * @param display O DisplayManager a ser escurecido/apagado por inatividade.
+     * @param settings Fonte do brilho salvo, restaurado quando o usuário volta.
+     */
+    PowerManager(DisplayManager& display, SettingManager& settings);
+
+    /**
+     * @brief Registra um pino de entrada que acorda o CPU ao mudar de nível.
+     * @param pin O pino (botão ou fase do encoder).
+     * @param hasEdgeIsr true se o pino tem attachInterrupt(CHANGE): a interrupção fica
+     *        desligada durante o sono (o wakeup por GPIO é por nível) e é restaurada depois.
+     */
+    void addWakePin(uint8_t pin, bool hasEdgeIsr);
+
+    /**
+     * @brief Registra uma função chamada a cada saída do light sleep, com as interrupções
+     *        já restauradas. Serve para contar a borda que acordou o CPU (ex: encoder).
+     * @param callback A função a ser chamada, ou nullptr.
+     */
+    void setWakeCallback(void (*callback)());
+
+    /**
+     * @brief Desliga os rádios que não estão em uso. Deve ser chamado no setup().
+     */
+    void init();
+
+    /**
+     * @brief Informa o módulo em execução. Deve ser chamado ao abrir um módulo e ao
+     *        voltar ao menu. Com nullptr (só menu), o módulo anterior é parado, os
+     *        rádios são desligados e o light sleep é permitido.
+     * @param module O módulo ativo ou nullptr.
+     */
+    void setActiveModule(const ModuleEntry* module);
+
+    /**
+     * @brief Indica se o módulo ativo foi parado por inatividade.
+     *        Enquanto estiver, o loop do módulo não deve rodar.
+     */
+    bool isModulePaused();
+
+    /**
+     * @brief Deve ser chamado sempre que houver entrada do usuário.
+     *        Reinicia o contador de inatividade e reacende o display.
+     */
+    void notifyActivity();
+
+    /**
+     * @brief Indica se o display está apagado por inatividade.
+     *        Enquanto estiver, não há motivo para redesenhar a tela.
+     */
+    bool isDisplayOff();
+
+    /**
+     * @brief Espera até o próximo tick da UI. Sem módulo de rádio ativo, dorme em
+     *        light sleep até o tick ou até uma entrada; senão apenas cede o CPU.
+     * @param tickMs O intervalo do tick da UI, em milissegundos.
+     */
+    void idle(uint32_t tickMs);
+
+    /**
+     * @brief Imprime no Serial o duty cycle (tempo acordado), o atraso dos wakes por
+     *        timer e o tempo de resposta dos wakes por entrada medidos desde o último
+     *        relatório, e zera as estatísticas.
+     */
+    void report();
+
+private:
+    enum DisplayState { DISPLAY_ON, DISPLAY_DIMMED, DISPLAY_OFF };
+
+    DisplayManager& display;
+    SettingManager& settings;
+    const ModuleEntry* activeModule;
+    bool modulePaused;         // módulo parado (stop) enquanto a tela está apagada
+    DisplayState displayState;
+    unsigned long lastActivityTime;
+
+    uint8_t wakePins[POWER_MAX_WAKE_PINS];
+    bool wakePinHasIsr[POWER_MAX_WAKE_PINS];
+    uint8_t wakePinCount;
+    void (*wakeCallback)();
+
+    // Estatísticas desde o último report()
+    uint64_t statsStart;       // micros de início da janela
+    uint64_t sleptMicros;      // tempo total em light sleep
+    uint32_t timerWakeups;
+    uint32_t gpioWakeups;
+    uint64_t latencyTotal;     // soma do atraso além do tempo pedido (wakeups por timer)
+    uint32_t latencyMax;
+    uint64_t inputLatencyTotal; // soma do tempo do wake até a entrada pronta (wakeups por GPIO)
+    uint32_t inputLatencyMax;
+
+    /**
+     * @brief Atualiza o estado do display conforme o tempo sem entrada.
+     */
+    void updateDisplayPower();
+
+    /**
+     * @brief Põe os nRF24 em power-down e para as pilhas WiFi/BLE do perfil.
+     */
+    void powerDownRadios();
+
+    /**
+     * @brief Entra em light sleep por até `sleepMs`, acordando também pelos pinos de entrada.
+     */
+    void lightSleep(uint32_t sleepMs);
+};
+
+#endif // POWER_MANAGER_H
@@ -0,0 +1,202 @@
+#include "UpdateManager.h"
+
+#if FEATURE_SD_UPDATE
+
+#include <Update.h>
+#include "config.h" // SD_CS_PIN, FIRMWARE_FILE e FIRMWARE_HASH_FILE
+
+UpdateManager::UpdateManager(DisplayManager& display)
+    : display(display), buffers{nullptr, nullptr},
+      freeQueue(nullptr), filledQueue(nullptr), stopRequested(false) {}
+
+bool UpdateManager::isUpdateAvailable() {
+    if (!SD.begin(SD_CS_PIN)) {
+        return false;
+    }
+    return SD.exists(FIRMWARE_FILE);
+}
+
+bool UpdateManager::loadExpectedHash(uint8_t expected[32]) {
+    File hashFile = SD.open(FIRMWARE_HASH_FILE, FILE_READ);
+    if (!hashFile) {
+        return false;
+    }
+
+    // Aceita o formato do `sha256sum`: os 64 primeiros caracteres são o hash.
+    char hex[64];
+    size_t n = hashFile.read((uint8_t*)hex, sizeof(hex));
+    hashFile.close();
+    if (n != sizeof(hex)) {
+        return false;
+    }
+
+    for (int i = 0; i < 32; i++) {
+        char pair[3] = { hex[i * 2], hex[i * 2 + 1], '\0' };
+        if (!isxdigit(pair[0]) || !isxdigit(pair[1])) {
+            return false;
+        }
+        expected[i] = (uint8_t)strtoul(pair, nullptr, 16);
+    }
+    return true;
+}
+
+void UpdateManager::readerLoop(void* arg) {
+    UpdateManager* self = static_cast<UpdateManager*>(arg);
+
+    // Enquanto um buffer é gravado na flash, o outro já está sendo lido do SD.
+    for (;;) {
+        Chunk chunk = { 0, 0 };
+        xQueueReceive(self->freeQueue, &chunk.index, portMAX_DELAY);
+        if (!self->stopRequested) {
+            chunk.length = self->firmwareFile.read(self->buffers[chunk.index], UPDATE_CHUNK_SIZE);
+        }
+        xQueueSend(self->filledQueue, &chunk, portMAX_DELAY);
+        if (chunk.length == 0) {
+            break; // Fim do arquivo (ou parada solicitada): avisa e encerra.
+        }
+    }
+    vTaskDelete(nullptr);
+}
+
+bool UpdateManager::runUpdate() {
+    display.showActivityScreen("Checking SD...");
+
+    if (!SD.begin(SD_CS_PIN)) {
+        return fail("No SD card");
+    }
+
+    uint8_t expected[32];
+    if (!loadExpectedHash(expected)) {
+        return fail("No SHA-256 file");
+    }
+
+    firmwareFile = SD.open(FIRMWARE_FILE, FILE_READ);
+    if (!firmwareFile) {
+        return fail("No firmware file");
+    }
+
+    size_t totalSize = firmwareFile.size();
+    if (totalSize == 0) {
+        return fail("Empty firmware file");
+    }
+    if (!Update.begin(totalSize, U_FLASH)) {
+        // O motivo exato (imagem grande demais, sem partição OTA...) vai para o Serial.
+        Serial.print("Update.begin falhou: ");
+        Serial.println(Update.errorString());
+        return fail("Update failed");
+    }
+
+    // Só dois blocos em RAM, nunca a imagem inteira.
+    buffers[0] = (uint8_t*)malloc(UPDATE_CHUNK_SIZE);
+    buffers[1] = (uint8_t*)malloc(UPDATE_CHUNK_SIZE);
+    if (!buffers[0] || !buffers[1]) {
+        return fail("Out of memory");
+    }
+
+    if (!freeQueue) {
+        freeQueue = xQueueCreate(2, sizeof(uint8_t));
+        filledQueue = xQueueCreate(2, sizeof(Chunk));
+    }
+    if (!freeQueue || !filledQueue) {
+        return fail("Out of memory");
+    }
+    xQueueReset(freeQueue);
+    xQueueReset(filledQueue);
+
+    for (uint8_t i = 0; i < 2; i++) {
+        xQueueSend(freeQueue, &i, 0);
+    }
+    stopRequested = false;
+
+    // O loop do Arduino roda no core 1; a leitura do SD fica no core 0.
+    if (xTaskCreatePinnedToCore(readerLoop, "sdReader", 4096, this, 1, nullptr, 0) != pdPASS) {
+        return fail("Reader task failed");
+    }
+
+    mbedtls_sha256_context sha;
+    mbedtls_sha256_init(&sha);
+    mbedtls_sha256_starts(&sha, 0); // 0 = SHA-256 (não SHA-224)
+
+    unsigned long startTime = millis();
+    size_t written = 0;
+    bool writeOk = true;
+    int lastPercent = -1;
+
+    // Consome os blocos até o leitor avisar o fim com um bloco vazio.
+    // Mesmo após um erro a fila é drenada, para a task terminar antes de
+    // liberarmos os buffers.
+    for (;;) {
+        Chunk chunk;
+        xQueueReceive(filledQueue, &chunk, portMAX_DELAY);
+        if (chunk.length == 0) {
+            break;
+        }
+
+        if (writeOk) {
+            uint8_t* data = buffers[chunk.index];
+            mbedtls_sha256_update(&sha, data, chunk.length);
+
+            if (Update.write(data, chunk.length) != chunk.length) {
+                writeOk = false;
+                stopRequested = true;
+            } else {
+                written += chunk.length;
+                int percent = (int)((uint64_t)written * 100 / totalSize);
+                if (percent != lastPercent) {
+                    display.showProgress("Updating...", percent);
+                    lastPercent = percent;
+                }
+            }
+        }
+
+        xQueueSend(freeQueue, &chunk.index, portMAX_DELAY);
+    }
+
+    uint8_t digest[32];
+    mbedtls_sha256_finish(&sha, digest);
+    mbedtls_sha256_free(&sha);
+
+    if (!writeOk) {
+        return fail("Flash write failed");
+    }
+    if (written != totalSize) {
+        return fail("SD read failed");
+    }
+    // Com o hash errado o Update é abortado: a partição de boot não muda.
+    if (memcmp(digest, expected, sizeof(digest)) != 0) {
+        return fail("SHA-256 mismatch");
+    }
+    if (!Update.end()) {
+        return fail("Image invalid");
+    }
+
+    Serial.printf("Firmware atualizado: %u bytes em %lu ms\n", written, millis() - startTime);
+    releaseResources();
+    display.showActivityScreen("Update OK");
+    return true;
+}
+
+bool UpdateManager::fail(const char* message) {
+    Serial.print("Falha na atualizacao: ");
+    Serial.println(message);
+
+    if (Update.isRunning()) {
+        Update.abort();
+    }
+    releaseResources();
+    display.showActivityScreen(message);
+    return false;
+}
+
+void UpdateManager::releaseResources() {
+    free(buffers[0]);
+    free(buffers[1]);
+    buffers[0] = nullptr;
+    buffers[1] = nullptr;
+
+    if (firmwareFile) {
+        firmwareFile.close();
+    }
+}
+
+#endif // FEATURE_SD_UPDATE
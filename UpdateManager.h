@@ -0,0 +1,89 @@
+#ifndef UPDATE_MANAGER_H
+#define UPDATE_MANAGER_H
+
+#include "feature_flags.h"
+
+// Só existe nos perfis com SD/Update (ver feature_flags.h).
+#if FEATURE_SD_UPDATE
+
+#include <Arduino.h>
+#include <SD.h>
+#include <mbedtls/sha256.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+
+#include "DisplayManager.h"
+
+// Tamanho de cada bloco lido do SD. Múltiplo do setor do SD (512) e do
+// setor de flash (4096), para que cada Update.write grave setores inteiros.
+#define UPDATE_CHUNK_SIZE 8192
+
+class UpdateManager {
+public:
+    /**
+     * @brief Construtor da classe UpdateManager.
+     * @param display O DisplayManager usado para mostrar o progresso da atualização.
+     */
+    UpdateManager(DisplayManager& display);
+
+    /**
+     * @brief Verifica se existe uma imagem de firmware no cartão SD.
+     * @return true se o cartão foi montado e o arquivo de firmware existe.
+     */
+    bool isUpdateAvailable();
+
+    /**
+     * @brief Grava o firmware do cartão SD na partição OTA livre.
+     *        A imagem é lida em blocos com buffer duplo (leitura antecipada em outra task)
+     *        e o SHA-256 é calculado durante a gravação. Se o hash não bater com o
+     *        arquivo .sha256, a partição de boot não é trocada.
+     * @return true se a imagem foi gravada, verificada e marcada para o próximo boot.
+     */
+    bool runUpdate();
+
+private:
+    // Um bloco lido do SD: índice do buffer e número de bytes válidos.
+    struct Chunk {
+        uint8_t index;
+        size_t  length;
+    };
+
+    DisplayManager& display;
+
+    File firmwareFile;
+    uint8_t* buffers[2];
+    // As filas são criadas uma vez e reaproveitadas, assim a task de leitura
+    // nunca usa uma fila já destruída ao terminar.
+    QueueHandle_t freeQueue;    // buffers prontos para serem preenchidos pelo leitor
+    QueueHandle_t filledQueue;  // buffers com dados prontos para Update.write
+    volatile bool stopRequested; // pede ao leitor que pare (erro de gravação)
+
+    /**
+     * @brief Lê o hash esperado (64 caracteres hex) do arquivo FIRMWARE_HASH_FILE.
+     * @param expected Destino dos 32 bytes do hash.
+     * @return true se o arquivo existe e contém um hash válido.
+     */
+    bool loadExpectedHash(uint8_t expected[32]);
+
+    /**
+     * @brief Task FreeRTOS que lê o arquivo do SD à frente da gravação.
+     *        Envia um Chunk com length 0 ao chegar no fim do arquivo (ou em erro).
+     */
+    static void readerLoop(void* arg);
+
+    /**
+     * @brief Mostra uma mensagem de erro, libera os recursos e aborta o Update.
+     * @return Sempre false, para ser usado como `return fail("...")`.
+     */
+    bool fail(const char* message);
+
+    /**
+     * @brief Libera os buffers e fecha o arquivo de firmware.
+     */
+    void releaseResources();
+};
+
+#endif // FEATURE_SD_UPDATE
+
+#endif // UPDATE_MANAGER_H
@@ -4,8 +4,9 @@
    ________________________________________ */
 
 #include "config.h"
-#include "icon.h"
+#include "DisplayManager.h" // blitText: texto direto do atlas, sem setFont
 
+#if FEATURE_BLE_TX && FEATURE_NRF24_TX
 namespace BleJammer {
 
   enum OperationMode { DEACTIVE_MODE, BLE_MODULE, Bluetooth_MODULE };
@@ -78,29 +79,20 @@ namespace BleJammer {
 
   void updateOLED() {
     u8g2.clearBuffer();
-    u8g2.setFont(u8g2_font_6x10_tr);
-
-    u8g2.setCursor(0, 10);
-    u8g2.print("Mode:");
-    u8g2.setCursor(60, 10);
-    u8g2.print("[");
-    u8g2.print(currentMode == BLE_MODULE ? "BLE" : currentMode == Bluetooth_MODULE ? "Bluetooth" : "Deactive");
-    u8g2.print("]");
-
-    u8g2.setCursor(0, 35);
-    u8g2.print("Radio 1: ");
-    u8g2.setCursor(70, 35);
-    u8g2.print(RadioA.isChipConnected() ? "Active" : "Inactive");
-
-    u8g2.setCursor(0, 50);
-    u8g2.print("Radio 2: ");
-    u8g2.setCursor(70, 50);
-    u8g2.print(RadioB.isChipConnected() ? "Active" : "Inactive");
-
-    u8g2.setCursor(0, 64);
-    u8g2.print("Radio 3: ");
-    u8g2.setCursor(70, 64);
-    u8g2.print(RadioC.isChipConnected() ? "Active" : "Inactive");
+
+    // Linhas alinhadas às páginas: texto direto do atlas
+    String mode = String("[") + (currentMode == BLE_MODULE ? "BLE" : currentMode == Bluetooth_MODULE ? "Bluetooth" : "Deactive") + "]";
+    DisplayManager::blitText(u8g2, 0, 0, "Mode:");
+    DisplayManager::blitText(u8g2, 60, 0, mode.c_str());
+
+    DisplayManager::blitText(u8g2, 0, 24, "Radio 1:");
+    DisplayManager::blitText(u8g2, 70, 24, RadioA.isChipConnected() ? "Active" : "Inactive");
+
+    DisplayManager::blitText(u8g2, 0, 40, "Radio 2:");
+    DisplayManager::blitText(u8g2, 70, 40, RadioB.isChipConnected() ? "Active" : "Inactive");
+
+    DisplayManager::blitText(u8g2, 0, 56, "Radio 3:");
+    DisplayManager::blitText(u8g2, 70, 56, RadioC.isChipConnected() ? "Active" : "Inactive");
 
     u8g2.sendBuffer();
   }
@@ -147,9 +139,11 @@ namespace BleJammer {
     }
   }
 }
+#endif // FEATURE_BLE_TX && FEATURE_NRF24_TX
 
 
 
+#if FEATURE_BLE_RX
 namespace BleScan {
 
 BLEScan* scan;
@@ -167,7 +161,6 @@ unsigned long debounce_Delay = 200;
 
 void blescanSetup() {
   Serial.begin(115200);
-  u8g2.setFont(u8g2_font_6x10_tr);
   
   BLEDevice::init("");
   scan = BLEDevice::getScan();
@@ -182,8 +175,7 @@ void blescanSetup() {
   for (int cycle = 0; cycle < 3; cycle++) { 
     for (int i = 0; i < 3; i++) {
       u8g2.clearBuffer();
-      u8g2.setFont(u8g2_font_6x10_tr);
-      u8g2.drawStr(0, 10, "Scanning BLE");
+      DisplayManager::blitText(u8g2, 0, 0, "Scanning BLE");
 
       String dots = "";
       for (int j = 0; j <= i; j++) {
@@ -192,7 +184,7 @@ void blescanSetup() {
       }
       setNeoPixelColour("0");
       
-      u8g2.drawStr(75, 10, dots.c_str()); 
+      DisplayManager::blitText(u8g2, 75, 0, dots.c_str()); 
 
       u8g2.sendBuffer();
       delay(300); 
@@ -210,7 +202,7 @@ void blescanLoop() {
     results = scan->getResults();
     scan->stop();
     u8g2.clearBuffer();
-    u8g2.drawStr(0, 10, "Scan complete.");
+    DisplayManager::blitText(u8g2, 0, 0, "Scan complete.");
     u8g2.sendBuffer();
   }
 
@@ -239,8 +231,7 @@ void blescanLoop() {
 
   if (!showDetails && scanComplete) {
     u8g2.clearBuffer();
-    u8g2.setFont(u8g2_font_5x8_tr);
-    u8g2.drawStr(0, 10, "BLE Devices:");
+    DisplayManager::blitText(u8g2, 0, 0, "BLE Devices:");
 
     int deviceCount = results.getCount();
     for (int i = 0; i < 5; i++) {
@@ -248,15 +239,16 @@ void blescanLoop() {
       if (deviceIndex >= deviceCount) break;
       BLEAdvertisedDevice device = results.getDevice(deviceIndex);
       String deviceName = device.getName().c_str();
-      u8g2.setFont(u8g2_font_6x10_tr);
       if (deviceName.length() == 0) {
         deviceName = "No Name";
       }
       String deviceInfo = deviceName.substring(0, 7) + " | RSSI " + String(device.getRSSI());
+      // Um dispositivo por página (8 px), a partir da página 2
+      int y = 16 + i * 8;
       if (deviceIndex == selectedIndex) {
-        u8g2.drawStr(0, 23 + i * 10, ">");
+        DisplayManager::blitText(u8g2, 0, y, ">");
       }
-      u8g2.drawStr(10, 23 + i * 10, deviceInfo.c_str());
+      DisplayManager::blitText(u8g2, 10, y, deviceInfo.c_str());
     }
     u8g2.sendBuffer();
   }
@@ -264,16 +256,15 @@ void blescanLoop() {
   if (showDetails) {
     BLEAdvertisedDevice device = results.getDevice(selectedIndex);
     u8g2.clearBuffer();
-    u8g2.setFont(u8g2_font_6x10_tr);
-    u8g2.drawStr(0, 10, "Device Details:");
-    u8g2.setFont(u8g2_font_5x8_tr);
+    DisplayManager::blitText(u8g2, 0, 0, "Device Details:");
     String name = "Name: " + String(device.getName().c_str());
-    String address = "Addr: " + String(device.getAddress().toString().c_str());
     String rssi = "RSSI: " + String(device.getRSSI());
-    u8g2.drawStr(0, 20, name.c_str());
-    u8g2.drawStr(0, 30, address.c_str());
-    u8g2.drawStr(0, 40, rssi.c_str());
-    u8g2.drawStr(0, 50, "Press LEFT to go back");
+    // Cabem 21 glifos por linha: o endereço (17) fica sozinho na página abaixo do rótulo
+    DisplayManager::blitText(u8g2, 0, 16, name.c_str());
+    DisplayManager::blitText(u8g2, 0, 24, "Addr:");
+    DisplayManager::blitText(u8g2, 0, 32, device.getAddress().toString().c_str());
+    DisplayManager::blitText(u8g2, 0, 40, rssi.c_str());
+    DisplayManager::blitText(u8g2, 0, 56, "Press LEFT to go back");
     u8g2.sendBuffer();
 
     if (digitalRead(BTN_PIN_LEFT) == LOW) {
@@ -283,8 +274,10 @@ void blescanLoop() {
     }  
   }  
 }
+#endif // FEATURE_BLE_RX
 
 
+#if FEATURE_BLE_TX
 namespace SourApple {
 
 std::string device_uuid = "00003082-0000-1000-9000-00805f9b34fb";
@@ -302,9 +295,9 @@ uint32_t delayMilliseconds = 1000;
 void updatedisplay() {
   u8g2.clearBuffer();
 
+  // Uma linha por página: as MAX_LINES (8) linhas cabem inteiras na tela
   for (int i = 0; i < MAX_LINES; i++) {
-    u8g2.setCursor(0, (i + 1) * 12);
-    u8g2.print(lines[i]);
+    DisplayManager::blitText(u8g2, 0, i * 8, lines[i].c_str());
   }
 
   u8g2.sendBuffer();
@@ -364,8 +357,6 @@ BLEAdvertisementData getOAdvertisementData() {
 }
 
 void sourappleSetup() {
-  
-  u8g2.setFont(u8g2_font_profont11_tf); 
 
   BLEDevice::init("");
   esp_ble_tx_power_set(ESP_BLE_PWR_TYPE_DEFAULT, ESP_PWR_LVL_P9); 
@@ -526,29 +517,23 @@ namespace Spoofer {
 
   void updateDisplay() {
     u8g2.clearBuffer();
-    u8g2.setFont(u8g2_font_profont11_tf);
     int xshift = 4;
     for (int i = 0; i < menuSize; i++) {
-      int y = (i == 0) ? 14 : (i == 1) ? 43 : 57;
+      // Linhas alinhadas às páginas (o dispositivo ocupa a página 3, abaixo do item 0);
+      // o item selecionado é destacado em vídeo inverso
+      int y = (i == 0) ? 8 : (i == 1) ? 40 : 56;
       if (menuIndex == i) {
-        u8g2.setFont(u8g2_font_5x7_tf);
-        u8g2.drawStr(0 + xshift, y, ">");
-        u8g2.setFont(u8g2_font_profont11_tf);
-        u8g2.drawStr(8 + xshift, y, menuItems[i]);
-      } else {
-        u8g2.setFont(u8g2_font_5x7_tf);
-        u8g2.drawStr(8 + xshift, y, menuItems[i]);
+        DisplayManager::blitText(u8g2, 0 + xshift, y, ">");
       }
-      u8g2.setFont(u8g2_font_5x7_tf);
+      DisplayManager::blitText(u8g2, 8 + xshift, y, menuItems[i], menuIndex == i);
       if (i == 0) {
         String deviceText = String("[ ") + String(deviceNames[deviceType - 1]) + String(" ]");
-        if (deviceText.length() > 25) deviceText = deviceText.substring(0, 15) + "...";
-        u8g2.drawStr(5 + xshift, 26, deviceText.c_str());
+        if (deviceText.length() > 19) deviceText = deviceText.substring(0, 16) + "...";
+        DisplayManager::blitText(u8g2, 5 + xshift, 24, deviceText.c_str());
       } else if (i == 1) {
-        u8g2.drawStr(81 + xshift, 43, advTypes[advType - 1]);
+        DisplayManager::blitText(u8g2, 81 + xshift, y, advTypes[advType - 1]);
       } else {
-        u8g2.setCursor(81 + xshift, 57);
-        u8g2.print(isAdvertising ? "Active" : "Disable");
+        DisplayManager::blitText(u8g2, 81 + xshift, y, isAdvertising ? "Active" : "Disable");
       }
     }
     u8g2.drawHLine(0, 0, 4); u8g2.drawVLine(0, 0, 4);
@@ -734,3 +719,4 @@ namespace Spoofer {
     setNeoPixelColour(color);
   }
 }
+#endif // FEATURE_BLE_TX
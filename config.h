@@ -10,6 +10,8 @@
 // 1. INCLUDES DE BIBLIOTECAS
 // Todas as bibliotecas necessárias para o projeto.
 // =================================================================
+#include "feature_flags.h" // Flags de perfil: decidem quais bibliotecas entram no build
+
 #include <Arduino.h>
 #include <U8g2lib.h>
 #include <Wire.h>
@@ -19,15 +21,25 @@
 #include <Preferences.h>
 #include <vector>
 #include <string>
+#if FEATURE_SD_UPDATE
 #include <SD.h>
 #include <Update.h>
+#endif
+#if FEATURE_BLE_STACK
 #include <BLEDevice.h>
 #include <BLEUtils.h>
+#endif
+#if FEATURE_BLE_TX
 #include <BLEServer.h>
+#endif
+#if FEATURE_NRF24_TX
 #include <nRF24L01.h>
 #include <RF24.h>
+#endif
+#if FEATURE_WIFI_STACK
 #include <WiFi.h>
 #include <esp_wifi.h>
+#endif
 
 // Inclui o arquivo de configurações/funções auxiliares
 #include "setting.h"
@@ -47,9 +59,16 @@
 #define BTN_PIN_RIGHT       27
 #define BTN_PIN_LEFT        25
 
-// Pino do Cartão SD
-#define SD_CS_PIN 5
+// Pinos do encoder do menu (o botão é o push do próprio encoder).
+// 34/35 são só de entrada e não têm pull-up interno: usam os pull-ups do módulo do encoder.
+#define ENCODER_PIN_A 34
+#define ENCODER_PIN_B 35
+#define BUTTON_PIN    14
+
+// Pino do Cartão SD (fora dos pinos de strapping 0, 2, 5, 12 e 15)
+#define SD_CS_PIN 13
 #define FIRMWARE_FILE "/firmware.bin"
+#define FIRMWARE_HASH_FILE "/firmware.sha256" // Saída do `sha256sum firmware.bin`
 
 // Pinos do nRF24
 #define NRF_CE_PIN_A    5  
@@ -59,6 +78,24 @@
 #define NRF_CE_PIN_C    15  
 #define NRF_CSN_PIN_C   2  
 
+// Cada pino acima precisa ser único: o PowerManager configura os CE/CSN dos nRF24
+// como saída ao desligar os rádios, o que travaria um botão ou o CS do SD no mesmo pino.
+constexpr uint8_t ALL_PINS[] = {
+  BUTTON_UP_PIN, BUTTON_SELECT_PIN, BUTTON_DOWN_PIN, BTN_PIN_RIGHT, BTN_PIN_LEFT,
+  ENCODER_PIN_A, ENCODER_PIN_B, BUTTON_PIN, SD_CS_PIN,
+  NRF_CE_PIN_A, NRF_CSN_PIN_A, NRF_CE_PIN_B, NRF_CSN_PIN_B, NRF_CE_PIN_C, NRF_CSN_PIN_C,
+};
+
+// Compara cada par (i, j) com j > i; recursivo porque o C++11 só aceita um return em constexpr.
+constexpr bool pinsAreUnique(const uint8_t* pins, int count, int i = 0, int j = 1) {
+  return i >= count ? true
+       : j >= count ? pinsAreUnique(pins, count, i + 1, i + 2)
+       : pins[i] != pins[j] && pinsAreUnique(pins, count, i, j + 1);
+}
+
+static_assert(pinsAreUnique(ALL_PINS, sizeof(ALL_PINS) / sizeof(ALL_PINS[0])),
+              "Dois periféricos no mesmo pino: revise os #define de pinos em config.h");
+
 
 // =================================================================
 // 3. DECLARAÇÕES EXTERNAS (extern)
@@ -75,17 +112,25 @@ extern uint8_t oledBrightness;
 // Avisa ao compilador sobre as funções que existem nos diferentes módulos.
 // =================================================================
 
+// Cada bloco só é declarado quando o perfil ativo inclui o módulo
+// (ver feature_flags.h); módulos fora do perfil não são compilados nem linkados.
+
 // BLE-related namespaces
+#if FEATURE_BLE_TX && FEATURE_NRF24_TX
 namespace BleJammer {
   void blejammerSetup();
   void blejammerLoop();
 }
+#endif
 
+#if FEATURE_BLE_RX
 namespace BleScan {
   void blescanSetup();
   void blescanLoop();
 }
+#endif
 
+#if FEATURE_BLE_TX
 namespace SourApple {
   void sourappleSetup();
   void sourappleLoop();
@@ -95,37 +140,47 @@ namespace Spoofer {
   void spooferSetup();
   void spooferLoop();
 }
+#endif
 
 // nRF24-related namespaces
+#if FEATURE_NRF24_RX
 namespace Analyzer {
   void analyzerSetup();
   void analyzerLoop();
-}
-
-namespace ProtoKill {
-  void blackoutSetup();
-  void blackoutLoop();
+  void analyzerStop();
 }
 
 namespace Scanner {
   void scannerSetup();
   void scannerLoop();
 }
+#endif
+
+#if FEATURE_NRF24_TX
+namespace ProtoKill {
+  void blackoutSetup();
+  void blackoutLoop();
+}
 
 namespace Jammer {
   void jammerSetup();
   void jammerLoop();
 }
+#endif
 
 // WiFi-related namespaces
+#if FEATURE_WIFI_RX
 namespace WifiScan {
   void wifiscanSetup();
   void wifiscanLoop();
 }
+#endif
 
+#if FEATURE_WIFI_TX
 namespace Deauther {
   void deautherSetup();
   void deautherLoop();
 }
+#endif
 
 #endif // CONFIG_H
\ No newline at end of file
@@ -0,0 +1,51 @@
+/* ____________________________
+   This software is licensed under the MIT License:
+   https://github.com/cifertech/nrfbox
+   ________________________________________ */
+
+#ifndef FEATURE_FLAGS_H
+#define FEATURE_FLAGS_H
+
+// =================================================================
+// 1. SELEÇÃO DO PERFIL DE BUILD
+// O perfil é escolhido em tempo de compilação, por exemplo:
+//   arduino-cli compile --build-property "compiler.cpp.extra_flags=-DNRFBOX_PROFILE_SURVEY"
+// Sem nenhuma flag, o perfil completo (todos os módulos) é usado.
+// =================================================================
+#if defined(NRFBOX_PROFILE_SURVEY)
+  // Perfil "survey": somente recepção (Analyzer, WifiScan, BleScan + UI).
+  #define NRFBOX_PROFILE_NAME "survey"
+  #define FEATURE_NRF24_RX    1
+  #define FEATURE_NRF24_TX    0
+  #define FEATURE_WIFI_RX     1
+  #define FEATURE_WIFI_TX     0
+  #define FEATURE_BLE_RX      1
+  #define FEATURE_BLE_TX      0
+  #define FEATURE_SD_UPDATE   0
+#else
+  // Perfil "full": comportamento original, todos os módulos compilados.
+  #define NRFBOX_PROFILE_NAME "full"
+  #define FEATURE_NRF24_RX    1
+  #define FEATURE_NRF24_TX    1
+  #define FEATURE_WIFI_RX     1
+  #define FEATURE_WIFI_TX     1
+  #define FEATURE_BLE_RX      1
+  #define FEATURE_BLE_TX      1
+  #define FEATURE_SD_UPDATE   1
+#endif
+
+// Flags derivadas: a pilha (biblioteca) só entra no build se algum módulo a usa.
+#define FEATURE_WIFI_STACK  (FEATURE_WIFI_RX || FEATURE_WIFI_TX)
+#define FEATURE_BLE_STACK   (FEATURE_BLE_RX || FEATURE_BLE_TX)
+
+
+// =================================================================
+// 2. NOME DO PERFIL
+// Quem decide o que entra no firmware são os #if com as macros acima
+// (em config.h e nos .cpp de cada módulo); aqui fica só o nome para logs.
+// =================================================================
+namespace Features {
+  constexpr const char* profileName = NRFBOX_PROFILE_NAME;
+}
+
+#endif // FEATURE_FLAGS_H
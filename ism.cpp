@@ -7,7 +7,9 @@
 #include <SPI.h>
 #include "config.h" // Continua necessário para os ponteiros de função e u8g2
 #include "setting.h"  // Para as definições de pinos
+#include "DisplayManager.h" // blitText: texto direto do atlas, sem setFont
 
+#if FEATURE_NRF24_RX
 //================================================================================
 // Módulo Analyzer
 //================================================================================
@@ -79,8 +81,7 @@ namespace Analyzer {
 
     // Desenha o gráfico no display
     u8g2.clearBuffer();
-    u8g2.setFont(u8g2_font_profont10_tf);
-    u8g2.drawStr(0, 8, "Analyzer");
+    DisplayManager::blitText(u8g2, 0, 0, "Analyzer");
     for (int i = 0; i < NUM_CHANNELS; i++) {
       if (state.values[i] == 1) {
         u8g2.drawPixel(i, 63); // Desenha um ponto se o canal estiver ocupado
@@ -88,8 +89,19 @@ namespace Analyzer {
     }
     u8g2.sendBuffer();
   }
+
+  void analyzerStop() {
+    // Sai do modo RX (CE baixo) e limpa PWR_UP: o rádio vai para power-down (~1 uA)
+    digitalWrite(NRF_CE, LOW);
+    digitalWrite(NRF_CSN, LOW);
+    SPI.transfer(NRF24_CONFIG | 0x20); // Comando de escrita
+    SPI.transfer(0x0D); // Mesmo CONFIG do setup (RX, 2-byte CRC), sem PWR_UP
+    digitalWrite(NRF_CSN, HIGH);
+  }
 }
+#endif // FEATURE_NRF24_RX
 
+#if FEATURE_NRF24_TX
 //================================================================================
 // Módulo Jammer
 //================================================================================
@@ -152,27 +164,26 @@ namespace Jammer {
 
   void updateDisplay() {
     u8g2.clearBuffer();
-    u8g2.setFont(u8g2_font_profont10_tf);
 
     // Desenha o título
     char title[15];
     sprintf(title, "Jammer [%s]", state.jamming ? "ON" : "OFF");
-    u8g2.drawStr(0, 8, title);
+    DisplayManager::blitText(u8g2, 0, 0, title);
 
-    // Desenha as opções do menu
+    // Desenha as opções do menu (uma por página, a partir da página 2)
     for (int i = 0; i < num_options; i++) {
-        if (i == state.current_option) {
-            u8g2.drawBox(0, 12 + i * 10, 60, 10);
-            u8g2.setDrawColor(0); // Inverte a cor para o texto
+        bool selected = (i == state.current_option);
+        if (selected) {
+            u8g2.drawBox(0, 16 + i * 8, 60, 8);
         }
-        u8g2.drawStr(2, 20 + i * 10, jammer_options[i]);
-        u8g2.setDrawColor(1); // Restaura a cor padrão
+        // Texto invertido sobre a caixa de destaque
+        DisplayManager::blitText(u8g2, 2, 16 + i * 8, jammer_options[i], selected);
     }
     
     // Mostra o valor do canal
     char channel_str[15];
     sprintf(channel_str, "CH: %d", state.current_channel);
-    u8g2.drawStr(70, 30, channel_str);
+    DisplayManager::blitText(u8g2, 70, 24, channel_str);
 
     u8g2.sendBuffer();
   }
@@ -183,7 +194,7 @@ namespace Jammer {
     pinMode(BTN_PIN_LEFT, INPUT_PULLUP);
     pinMode(BTN_PIN_RIGHT, INPUT_PULLUP);
     
-    u8g2.begin();
+    // O display já foi iniciado pelo DisplayManager; um novo begin() desfaria o brilho salvo
     updateDisplay();
   }
 
@@ -201,4 +212,5 @@ namespace Jammer {
 
     delay(50); // Pequeno delay para estabilidade
   }
-}
\ No newline at end of file
+}
+#endif // FEATURE_NRF24_TX
\ No newline at end of file
@@ -14,9 +14,11 @@
  * - SettingManager: Gerencia o salvamento e carregamento de configurações na EEPROM.
  * - DisplayManager: Controla tudo relacionado à tela OLED (desenho, brilho, etc.).
  * - NeoPixelManager: Comanda a fita de LEDs NeoPixel (cores, brilho, animações).
+ * - PowerManager: Light sleep entre os ticks da UI, rádios desligados e tela
+ *   escurecida/apagada por inatividade.
  *
- * O fluxo principal (loop) agora apenas lê a entrada do usuário (encoder e botão)
- * e delega as ações para os gerenciadores apropriados.
+ * O fluxo principal (loop) agora apenas lê a entrada do usuário (encoder e botão),
+ * delega as ações para os gerenciadores apropriados e redesenha só quando algo muda.
  * =================================================================================
  */
 
@@ -28,28 +30,57 @@
 #include "DisplayManager.h"
 #include "NeoPixelManager.h"
 #include "Encoder.h"
+#include "ModuleRegistry.h" // Módulos disponíveis no perfil de build ativo
+#include "UpdateManager.h"  // Atualização de firmware pelo cartão SD
+#include "PowerManager.h"
 
 // --- Configurações de Hardware e Pinos ---
-#define ENCODER_PIN_A 2
-#define ENCODER_PIN_B 3
-#define BUTTON_PIN    4
+// ENCODER_PIN_A/B e BUTTON_PIN ficam em config.h, junto dos demais pinos, para que o
+// static_assert de pinos únicos cubra também o encoder.
+
+// --- Temporização da UI ---
+#define UI_TICK_MS             50    // Intervalo entre ticks da UI (o CPU dorme entre eles)
+#define POWER_REPORT_INTERVAL  10000 // Intervalo do relatório de energia no Serial
 
 // --- Definições do Menu da Aplicação ---
-const char *menuItems[] = {"Scan WiFi", "Brightness", "LEDs Off"};
-const int MENU_ITEMS_COUNT = sizeof(menuItems) / sizeof(menuItems[0]);
+// O menu lista primeiro os módulos do registro (ModuleRegistry.h) do perfil
+// ativo e depois as ações fixas do aplicativo.
+const char *appItems[] = {
+  "Brightness", "LEDs Off",
+#if FEATURE_SD_UPDATE
+  "Update from SD",
+#endif
+};
+const int APP_ITEMS_COUNT = sizeof(appItems) / sizeof(appItems[0]);
+const int MENU_ITEMS_COUNT = MODULE_COUNT + APP_ITEMS_COUNT;
+const char *menuItems[MENU_ITEMS_COUNT]; // Preenchido em buildMenu()
+AtlasIconId menuIcons[MENU_ITEMS_COUNT]; // Ícone de cada item (ícone do módulo ou de ajustes)
+int menuItemsCount = MENU_ITEMS_COUNT;   // Itens visíveis (sem "Update from SD" se não houver imagem)
+
+// Botões usados pelos módulos: também acordam o CPU e contam como atividade
+const uint8_t moduleButtons[] = { BUTTON_UP_PIN, BUTTON_SELECT_PIN, BUTTON_DOWN_PIN, BTN_PIN_RIGHT, BTN_PIN_LEFT };
 
 // --- Instanciação dos Nossos Objetos Gerenciadores ---
-// Em vez de vários objetos globais (U8G2, Adafruit_NeoPixel),
-// agora temos apenas os nossos gerenciadores.
+// O único objeto de biblioteca global é o u8g2 (declarado extern em config.h):
+// os módulos desenham nele, e o DisplayManager o inicia e controla.
+U8G2_SSD1306_128X64_NONAME_F_HW_I2C u8g2(U8G2_R0, /* reset=*/ U8X8_PIN_NONE);
+
 SettingManager  settings;
-DisplayManager  display;
+DisplayManager  display(u8g2);
 NeoPixelManager leds;
 Encoder         encoder(ENCODER_PIN_A, ENCODER_PIN_B);
+#if FEATURE_SD_UPDATE
+UpdateManager   updater(display);
+#endif
+PowerManager    power(display, settings);
 
 // --- Variáveis de Estado da Aplicação ---
 // Estas variáveis controlam o estado atual da UI.
 int  selectedItem = 0;
 long lastEncoderPos = -999;
+bool menuDirty = true;             // true quando o menu precisa ser redesenhado
+const ModuleEntry* runningModule = nullptr; // Módulo aberto pelo menu (nullptr = menu)
+unsigned long lastPowerReport = 0;
 
 
 // =================================================================================
@@ -71,10 +102,29 @@ void setup() {
   leds.setColor(0, 0, 255); // Cor azul para indicar que ligou
   delay(1000);
   leds.clear();
+
+  // Monta o menu (verifica no SD se há firmware para oferecer "Update from SD")
+  buildMenu();
   
-  // Configura o pino do botão do encoder
+  // Configura o pino do botão do encoder e os botões dos módulos
   pinMode(BUTTON_PIN, INPUT_PULLUP);
+  for (uint8_t pin : moduleButtons) {
+    pinMode(pin, INPUT_PULLUP);
+  }
+
+  // 4. Gerenciamento de energia: encoder e botões acordam o CPU do light sleep;
+  //    init() desliga os rádios, já que nenhum módulo está ativo no menu.
+  power.addWakePin(ENCODER_PIN_A, true);
+  power.addWakePin(ENCODER_PIN_B, true);
+  power.addWakePin(BUTTON_PIN, false);
+  for (uint8_t pin : moduleButtons) {
+    power.addWakePin(pin, false);
+  }
+  power.setWakeCallback(resyncEncoder);
+  power.init();
   
+  reportBuildProfile();
+
   Serial.println("nRFBox inicializado e pronto.");
 }
 
@@ -83,17 +133,69 @@ void setup() {
 //   LOOP - Ciclo Principal da Aplicação
 // =================================================================================
 void loop() {
+  // Relatório de energia nos dois modos (menu e módulo, inclusive pausado)
+  if (millis() - lastPowerReport >= POWER_REPORT_INTERVAL) {
+    power.report();
+    lastPowerReport = millis();
+  }
+
+  // --- Módulo em Execução ---
+  // Enquanto um módulo roda, o loop é dele; o botão do encoder volta ao menu.
+  if (runningModule) {
+    long modulePos = encoder.read() / 4;
+    bool exitPressed = (digitalRead(BUTTON_PIN) == LOW);
+
+    if (exitPressed || modulePos != lastEncoderPos || moduleButtonPressed()) {
+      // Reacende a tela e retoma o módulo pausado; a entrada que acorda não sai do módulo
+      bool wasOff = power.isDisplayOff();
+      power.notifyActivity();
+      lastEncoderPos = modulePos;
+      if (wasOff) {
+        if (exitPressed) delay(200); // Debounce
+        exitPressed = false;
+      }
+    }
+
+    if (exitPressed) {
+      delay(200); // Debounce
+      stopModule();
+      return;
+    }
+
+    // Pausado (tela apagada), o módulo não roda e o CPU pode dormir até a próxima entrada
+    if (!power.isModulePaused()) {
+      runningModule->loop();
+    }
+    power.idle(UI_TICK_MS);
+    return;
+  }
+
   // --- Leitura de Entrada do Usuário ---
   
   // Lê o encoder e atualiza o item selecionado no menu
   long currentEncoderPos = encoder.read() / 4; // /4 para mais estabilidade
+  bool buttonPressed = (digitalRead(BUTTON_PIN) == LOW);
+
+  if (currentEncoderPos != lastEncoderPos || buttonPressed) {
+    // Com a tela apagada, a primeira entrada só reacende o display
+    bool wasOff = power.isDisplayOff();
+    power.notifyActivity();
+    menuDirty = true;
+
+    if (wasOff) {
+      lastEncoderPos = currentEncoderPos;
+      if (buttonPressed) delay(200); // Debounce: não dispara a ação ao acordar
+      buttonPressed = false;
+    }
+  }
+
   if (currentEncoderPos != lastEncoderPos) {
     selectedItem += (currentEncoderPos - lastEncoderPos);
     
     // Garante que o item selecionado permaneça dentro dos limites do menu
     if (selectedItem < 0) {
-      selectedItem = MENU_ITEMS_COUNT - 1;
-    } else if (selectedItem >= MENU_ITEMS_COUNT) {
+      selectedItem = menuItemsCount - 1;
+    } else if (selectedItem >= menuItemsCount) {
       selectedItem = 0;
     }
     
@@ -101,14 +203,21 @@ void loop() {
   }
 
   // Verifica se o botão foi pressionado
-  if (digitalRead(BUTTON_PIN) == LOW) {
+  if (buttonPressed) {
     delay(200); // Debounce simples para evitar múltiplos cliques
     handleMenuAction(selectedItem);
+    power.notifyActivity(); // Ações longas não contam como inatividade
   }
 
   // --- Atualização da Exibição ---
-  // Desenha o menu na tela a cada ciclo. O DisplayManager cuida de toda a complexidade.
-  display.drawMenu(menuItems, MENU_ITEMS_COUNT, selectedItem);
+  // Só redesenha quando algo mudou; com a tela apagada não há o que redesenhar.
+  if (menuDirty && !power.isDisplayOff()) {
+    display.drawMenu(menuItems, menuItemsCount, selectedItem, menuIcons);
+    menuDirty = false;
+  }
+
+  // Dorme até o próximo tick ou até o encoder/botão acordar o CPU
+  power.idle(UI_TICK_MS);
 }
 
 
@@ -116,38 +225,127 @@ void loop() {
 //   FUNÇÕES AUXILIARES - Lógica da Aplicação
 // =================================================================================
 
+/**
+ * @brief Imprime no Serial o perfil de build, os módulos registrados e o uso de flash/RAM.
+ *        Permite comparar os perfis (ex: "full" vs "survey") direto no dispositivo.
+ */
+void reportBuildProfile() {
+  Serial.printf("Perfil: %s (%d modulos)\n", Features::profileName, MODULE_COUNT);
+  for (int i = 0; i < MODULE_COUNT; i++) {
+    Serial.printf("  - %s%s\n", MODULES[i].name, MODULES[i].transmits ? " [TX]" : "");
+  }
+  Serial.printf("Flash: %u bytes usados, %u livres para OTA\n", ESP.getSketchSize(), ESP.getFreeSketchSpace());
+  Serial.printf("RAM: %u bytes de heap livres (min %u)\n", ESP.getFreeHeap(), ESP.getMinFreeHeap());
+}
+
+/**
+ * @brief Monta a lista do menu: módulos do registro seguidos das ações fixas.
+ *        "Update from SD" (último item) só aparece se houver firmware no cartão.
+ */
+void buildMenu() {
+  for (int i = 0; i < MODULE_COUNT; i++) {
+    menuItems[i] = MODULES[i].name;
+    menuIcons[i] = MODULES[i].icon;
+  }
+  for (int i = 0; i < APP_ITEMS_COUNT; i++) {
+    menuItems[MODULE_COUNT + i] = appItems[i];
+    menuIcons[MODULE_COUNT + i] = ATLAS_ICON_SETTING;
+  }
+  menuItemsCount = MENU_ITEMS_COUNT;
+#if FEATURE_SD_UPDATE
+  if (!updater.isUpdateAvailable()) {
+    menuItemsCount--;
+  }
+#endif
+}
+
 /**
  * @brief Executa a ação correspondente ao item de menu selecionado.
  * @param itemIndex O índice do item do menu que foi selecionado.
  */
 void handleMenuAction(int itemIndex) {
-  switch (itemIndex) {
-    case 0: // Scan WiFi
-      scanNetworks();
-      break;
-    case 1: // Brightness
+  // Os primeiros itens são os módulos do registro
+  if (itemIndex < MODULE_COUNT) {
+    startModule(&MODULES[itemIndex]);
+    return;
+  }
+
+  switch (itemIndex - MODULE_COUNT) {
+    case 0: // Brightness
       adjustBrightness();
       break;
-    case 2: // LEDs Off
+    case 1: // LEDs Off
       leds.clear();
       break;
+#if FEATURE_SD_UPDATE
+    case 2: // Update from SD
+      updateFromSD();
+      break;
+#endif
   }
 }
 
 /**
- * @brief Simula uma varredura de redes WiFi.
+ * @brief Abre um módulo do registro; a partir daí o loop() passa a rodar o módulo.
+ *        O PowerManager passa a mantê-lo acordado (e pode pausá-lo com a tela apagada).
+ * @param module O módulo a ser aberto.
  */
-void scanNetworks() {
-  Serial.println("Ação: Scan WiFi");
-  display.showActivityScreen("Scanning...");
-  leds.setColor(255, 255, 0); // Amarelo para indicar atividade
-  
-  // (Aqui entraria a sua lógica real de scan)
-  delay(3000); 
+void startModule(const ModuleEntry* module) {
+  Serial.print("Módulo: ");
+  Serial.println(module->name);
+  runningModule = module;
+  power.setActiveModule(runningModule);
+  runningModule->setup();
+}
+
+/**
+ * @brief Volta ao menu. O PowerManager chama o stop do módulo (se houver e ele não
+ *        estiver pausado) e desliga os rádios que o módulo ligou.
+ */
+void stopModule() {
+  power.setActiveModule(nullptr);
+  runningModule = nullptr;
+  display.clear();
+  menuDirty = true;
+}
+
+/**
+ * @brief Indica se algum dos botões usados pelos módulos está pressionado.
+ */
+bool moduleButtonPressed() {
+  for (uint8_t pin : moduleButtons) {
+    if (digitalRead(pin) == LOW) return true;
+  }
+  return false;
+}
+
+/**
+ * @brief Chamado pelo PowerManager ao sair do light sleep: conta a borda do encoder
+ *        que acordou o CPU enquanto a interrupção estava desligada.
+ */
+void resyncEncoder() {
+  encoder.resync();
+}
+
+#if FEATURE_SD_UPDATE
+/**
+ * @brief Grava o firmware do cartão SD e reinicia na nova imagem se tudo der certo.
+ *        Em caso de erro (inclusive hash inválido) o firmware atual continua ativo.
+ */
+void updateFromSD() {
+  Serial.println("Ação: Update from SD");
+  leds.setColor(255, 0, 255); // Magenta durante a gravação
+
+  bool updated = updater.runUpdate();
 
   leds.clear();
-  display.clear(); // Limpa a tela para o menu ser redesenhado no próximo loop
+  delay(2000); // Tempo para ler a mensagem final na tela
+  if (updated) {
+    ESP.restart();
+  }
+  display.clear();
 }
+#endif
 
 /**
  * @brief Entra em um modo para ajustar o brilho do display e dos LEDs.
@@ -0,0 +1,222 @@
+#!/usr/bin/env python3
+"""Gera atlas.h: ícones de icon.h + glifos 5x7 empacotados no formato de página do SSD1306.
+
+Formato de página: cada byte é uma coluna de 8 pixels verticais (bit 0 = pixel de cima),
+o mesmo layout do buffer do U8g2 para o SSD1306. Assim o DisplayManager copia os bytes
+do atlas direto para o buffer, sem desenhar pixel a pixel.
+
+Uso: python3 tools/gen_atlas.py   (rodar na raiz do sketch sempre que icon.h mudar)
+"""
+import os
+import re
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+ICON_FILE = os.path.join(ROOT, "icon.h")
+OUT_FILE = os.path.join(ROOT, "atlas.h")
+
+GLYPH_WIDTH = 5
+FIRST_CHAR = 0x20
+LAST_CHAR = 0x7E
+
+# Fonte 5x7 clássica (domínio público), ASCII 0x20..0x7E, uma coluna por byte.
+FONT_5X7 = [
+    0x00, 0x00, 0x00, 0x00, 0x00,  # ' '
+    0x00, 0x00, 0x5F, 0x00, 0x00,  # '!'
+    0x00, 0x07, 0x00, 0x07, 0x00,  # '"'
+    0x14, 0x7F, 0x14, 0x7F, 0x14,  # '#'
+    0x24, 0x2A, 0x7F, 0x2A, 0x12,  # '$'
+    0x23, 0x13, 0x08, 0x64, 0x62,  # '%'
+    0x36, 0x49, 0x55, 0x22, 0x50,  # '&'
+    0x00, 0x05, 0x03, 0x00, 0x00,  # '''
+    0x00, 0x1C, 0x22, 0x41, 0x00,  # '('
+    0x00, 0x41, 0x22, 0x1C, 0x00,  # ')'
+    0x14, 0x08, 0x3E, 0x08, 0x14,  # '*'
+    0x08, 0x08, 0x3E, 0x08, 0x08,  # '+'
+    0x00, 0x50, 0x30, 0x00, 0x00,  # ','
+    0x08, 0x08, 0x08, 0x08, 0x08,  # '-'
+    0x00, 0x60, 0x60, 0x00, 0x00,  # '.'
+    0x20, 0x10, 0x08, 0x04, 0x02,  # '/'
+    0x3E, 0x51, 0x49, 0x45, 0x3E,  # '0'
+    0x00, 0x42, 0x7F, 0x40, 0x00,  # '1'
+    0x42, 0x61, 0x51, 0x49, 0x46,  # '2'
+    0x21, 0x41, 0x45, 0x4B, 0x31,  # '3'
+    0x18, 0x14, 0x12, 0x7F, 0x10,  # '4'
+    0x27, 0x45, 0x45, 0x45, 0x39,  # '5'
+    0x3C, 0x4A, 0x49, 0x49, 0x30,  # '6'
+    0x01, 0x71, 0x09, 0x05, 0x03,  # '7'
+    0x36, 0x49, 0x49, 0x49, 0x36,  # '8'
+    0x06, 0x49, 0x49, 0x29, 0x1E,  # '9'
+    0x00, 0x36, 0x36, 0x00, 0x00,  # ':'
+    0x00, 0x56, 0x36, 0x00, 0x00,  # ';'
+    0x08, 0x14, 0x22, 0x41, 0x00,  # '<'
+    0x14, 0x14, 0x14, 0x14, 0x14,  # '='
+    0x00, 0x41, 0x22, 0x14, 0x08,  # '>'
+    0x02, 0x01, 0x51, 0x09, 0x06,  # '?'
+    0x32, 0x49, 0x79, 0x41, 0x3E,  # '@'
+    0x7E, 0x11, 0x11, 0x11, 0x7E,  # 'A'
+    0x7F, 0x49, 0x49, 0x49, 0x36,  # 'B'
+    0x3E, 0x41, 0x41, 0x41, 0x22,  # 'C'
+    0x7F, 0x41, 0x41, 0x22, 0x1C,  # 'D'
+    0x7F, 0x49, 0x49, 0x49, 0x41,  # 'E'
+    0x7F, 0x09, 0x09, 0x09, 0x01,  # 'F'
+    0x3E, 0x41, 0x49, 0x49, 0x7A,  # 'G'
+    0x7F, 0x08, 0x08, 0x08, 0x7F,  # 'H'
+    0x00, 0x41, 0x7F, 0x41, 0x00,  # 'I'
+    0x20, 0x40, 0x41, 0x3F, 0x01,  # 'J'
+    0x7F, 0x08, 0x14, 0x22, 0x41,  # 'K'
+    0x7F, 0x40, 0x40, 0x40, 0x40,  # 'L'
+    0x7F, 0x02, 0x0C, 0x02, 0x7F,  # 'M'
+    0x7F, 0x04, 0x08, 0x10, 0x7F,  # 'N'
+    0x3E, 0x41, 0x41, 0x41, 0x3E,  # 'O'
+    0x7F, 0x09, 0x09, 0x09, 0x06,  # 'P'
+    0x3E, 0x41, 0x51, 0x21, 0x5E,  # 'Q'
+    0x7F, 0x09, 0x19, 0x29, 0x46,  # 'R'
+    0x46, 0x49, 0x49, 0x49, 0x31,  # 'S'
+    0x01, 0x01, 0x7F, 0x01, 0x01,  # 'T'
+    0x3F, 0x40, 0x40, 0x40, 0x3F,  # 'U'
+    0x1F, 0x20, 0x40, 0x20, 0x1F,  # 'V'
+    0x3F, 0x40, 0x38, 0x40, 0x3F,  # 'W'
+    0x63, 0x14, 0x08, 0x14, 0x63,  # 'X'
+    0x07, 0x08, 0x70, 0x08, 0x07,  # 'Y'
+    0x61, 0x51, 0x49, 0x45, 0x43,  # 'Z'
+    0x00, 0x7F, 0x41, 0x41, 0x00,  # '['
+    0x02, 0x04, 0x08, 0x10, 0x20,  # '\'
+    0x00, 0x41, 0x41, 0x7F, 0x00,  # ']'
+    0x04, 0x02, 0x01, 0x02, 0x04,  # '^'
+    0x40, 0x40, 0x40, 0x40, 0x40,  # '_'
+    0x00, 0x01, 0x02, 0x04, 0x00,  # '`'
+    0x20, 0x54, 0x54, 0x54, 0x78,  # 'a'
+    0x7F, 0x48, 0x44, 0x44, 0x38,  # 'b'
+    0x38, 0x44, 0x44, 0x44, 0x20,  # 'c'
+    0x38, 0x44, 0x44, 0x48, 0x7F,  # 'd'
+    0x38, 0x54, 0x54, 0x54, 0x18,  # 'e'
+    0x08, 0x7E, 0x09, 0x01, 0x02,  # 'f'
+    0x0C, 0x52, 0x52, 0x52, 0x3E,  # 'g'
+    0x7F, 0x08, 0x04, 0x04, 0x78,  # 'h'
+    0x00, 0x44, 0x7D, 0x40, 0x00,  # 'i'
+    0x20, 0x40, 0x44, 0x3D, 0x00,  # 'j'
+    0x7F, 0x10, 0x28, 0x44, 0x00,  # 'k'
+    0x00, 0x41, 0x7F, 0x40, 0x00,  # 'l'
+    0x7C, 0x04, 0x18, 0x04, 0x78,  # 'm'
+    0x7C, 0x08, 0x04, 0x04, 0x78,  # 'n'
+    0x38, 0x44, 0x44, 0x44, 0x38,  # 'o'
+    0x7C, 0x14, 0x14, 0x14, 0x08,  # 'p'
+    0x08, 0x14, 0x14, 0x18, 0x7C,  # 'q'
+    0x7C, 0x08, 0x04, 0x04, 0x08,  # 'r'
+    0x48, 0x54, 0x54, 0x54, 0x20,  # 's'
+    0x04, 0x3F, 0x44, 0x40, 0x20,  # 't'
+    0x3C, 0x40, 0x40, 0x20, 0x7C,  # 'u'
+    0x1C, 0x20, 0x40, 0x20, 0x1C,  # 'v'
+    0x3C, 0x40, 0x30, 0x40, 0x3C,  # 'w'
+    0x44, 0x28, 0x10, 0x28, 0x44,  # 'x'
+    0x0C, 0x50, 0x50, 0x50, 0x3C,  # 'y'
+    0x44, 0x64, 0x54, 0x4C, 0x44,  # 'z'
+    0x00, 0x08, 0x36, 0x41, 0x00,  # '{'
+    0x00, 0x00, 0x7F, 0x00, 0x00,  # '|'
+    0x00, 0x41, 0x36, 0x08, 0x00,  # '}'
+    0x08, 0x04, 0x08, 0x10, 0x08,  # '~'
+]
+
+ICON_RE = re.compile(
+    r"//\s*'(?P<name>[^']+)',\s*(?P<w>\d+)x(?P<h>\d+)px\s*\r?\n"
+    r"\s*const unsigned char (?P<symbol>\w+)\s*\[\]\s*PROGMEM\s*=\s*\{(?P<body>[^}]*)\}",
+)
+
+
+def parse_icons(text):
+    """Lê os bitmaps XBM de icon.h. Ignora arrays incompletos (ex: 'empty')."""
+    icons = []
+    for m in ICON_RE.finditer(text):
+        w, h = int(m.group("w")), int(m.group("h"))
+        body = re.sub(r"//[^\n]*", "", m.group("body"))
+        data = [int(v, 16) for v in re.findall(r"0x[0-9a-fA-F]{2}", body)]
+        if len(data) != ((w + 7) // 8) * h:
+            print("aviso: '%s' tem %d bytes, esperado %d; ignorado"
+                  % (m.group("name"), len(data), ((w + 7) // 8) * h))
+            continue
+        icons.append((m.group("name"), w, h, data))
+    return icons
+
+
+def xbm_to_pages(w, h, data):
+    """XBM (linhas, LSB à esquerda) -> páginas SSD1306 (colunas, LSB em cima)."""
+    stride = (w + 7) // 8
+    pages = (h + 7) // 8
+    out = []
+    for page in range(pages):
+        for x in range(w):
+            byte = 0
+            for bit in range(8):
+                y = page * 8 + bit
+                if y < h and data[y * stride + x // 8] & (1 << (x % 8)):
+                    byte |= 1 << bit
+            out.append(byte)
+    return out, pages
+
+
+def format_bytes(values, indent="  "):
+    lines = []
+    for i in range(0, len(values), 16):
+        lines.append(indent + ", ".join("0x%02x" % v for v in values[i:i + 16]) + ",")
+    return lines
+
+
+def main():
+    with open(ICON_FILE, encoding="utf-8") as f:
+        icons = parse_icons(f.read())
+
+    assert len(FONT_5X7) == (LAST_CHAR - FIRST_CHAR + 1) * GLYPH_WIDTH
+
+    atlas = list(FONT_5X7)
+    entries = []
+    for name, w, h, data in icons:
+        packed, pages = xbm_to_pages(w, h, data)
+        entries.append((name, len(atlas), w, pages))
+        atlas.extend(packed)
+
+    out = []
+    out.append("// atlas.h - GERADO por tools/gen_atlas.py a partir de icon.h. Não edite à mão.")
+    out.append("")
+    out.append("#ifndef ATLAS_H")
+    out.append("#define ATLAS_H")
+    out.append("")
+    out.append("#include <Arduino.h>")
+    out.append("")
+    out.append("// Glifos 5x7 (ASCII 0x%02X..0x%02X) seguidos dos ícones, no formato de página do SSD1306:"
+               % (FIRST_CHAR, LAST_CHAR))
+    out.append("// um byte por coluna de 8 pixels, bit 0 em cima.")
+    out.append("#define ATLAS_GLYPH_WIDTH %d" % GLYPH_WIDTH)
+    out.append("#define ATLAS_FIRST_CHAR  0x%02X" % FIRST_CHAR)
+    out.append("#define ATLAS_LAST_CHAR   0x%02X" % LAST_CHAR)
+    out.append("")
+    out.append("const uint8_t ATLAS_DATA[%d] PROGMEM = {" % len(atlas))
+    out.extend(format_bytes(atlas))
+    out.append("};")
+    out.append("")
+    out.append("// Posição de cada ícone dentro de ATLAS_DATA.")
+    out.append("struct AtlasIcon {")
+    out.append("  uint16_t offset; // índice do primeiro byte em ATLAS_DATA")
+    out.append("  uint8_t  width;  // largura em colunas")
+    out.append("  uint8_t  pages;  // altura em páginas de 8 pixels")
+    out.append("};")
+    out.append("")
+    out.append("enum AtlasIconId {")
+    for name, _, _, _ in entries:
+        out.append("  ATLAS_ICON_%s," % re.sub(r"\W", "_", name).upper())
+    out.append("  ATLAS_ICON_COUNT")
+    out.append("};")
+    out.append("")
+    out.append("const AtlasIcon ATLAS_ICONS[ATLAS_ICON_COUNT] PROGMEM = {")
+    for name, offset, w, pages in entries:
+        out.append("  { %d, %d, %d }, // '%s'" % (offset, w, pages, name))
+    out.append("};")
+    out.append("")
+    out.append("#endif // ATLAS_H")
+
+    with open(OUT_FILE, "w", encoding="utf-8", newline="\r\n") as f:
+        f.write("\n".join(out) + "\n")
+    print("atlas.h: %d bytes (%d ícones)" % (len(atlas), len(entries)))
+
+
+if __name__ == "__main__":
+    main()
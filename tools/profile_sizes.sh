@@ -0,0 +1,23 @@
+#!/usr/bin/env bash
+# Compila o sketch em cada perfil de build e imprime o uso de flash/RAM.
+# Uso: tools/profile_sizes.sh [FQBN]   (padrão: esp32:esp32:esp32)
+set -euo pipefail
+
+FQBN="${1:-esp32:esp32:esp32}"
+SKETCH_DIR="$(cd "$(dirname "$0")/.." && pwd)"
+
+# nome do perfil -> flags extras do compilador (ver feature_flags.h)
+declare -A PROFILES=(
+  [full]=""
+  [survey]="-DNRFBOX_PROFILE_SURVEY"
+)
+
+for profile in full survey; do
+  flags="${PROFILES[$profile]}"
+  echo "== Perfil: ${profile} =="
+  arduino-cli compile --fqbn "$FQBN" \
+    --build-path "${SKETCH_DIR}/build/${profile}" \
+    --build-property "compiler.cpp.extra_flags=${flags}" \
+    --build-property "compiler.c.extra_flags=${flags}" \
+    "$SKETCH_DIR" | grep -E "Sketch uses|Global variables use"
+done
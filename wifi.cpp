@@ -4,8 +4,9 @@
    ________________________________________ */
 
 #include "config.h"
-#include "icon.h"
+#include "DisplayManager.h" // blitText: texto direto do atlas, sem setFont
 
+#if FEATURE_WIFI_RX
 namespace WifiScan {
   
 int currentIndex = 0;
@@ -20,7 +21,6 @@ unsigned long debounceTime = 200;
 
 void wifiscanSetup() {
   Serial.begin(115200);
-  u8g2.setFont(u8g2_font_6x10_tr);
   
   WiFi.mode(WIFI_STA);
   WiFi.disconnect();
@@ -33,8 +33,7 @@ void wifiscanSetup() {
   for (int cycle = 0; cycle < 3; cycle++) { 
     for (int i = 0; i < 3; i++) {
       u8g2.clearBuffer();
-      u8g2.setFont(u8g2_font_6x10_tr);
-      u8g2.drawStr(0, 10, "Scanning WiFi");
+      DisplayManager::blitText(u8g2, 0, 0, "Scanning WiFi");
 
       String dots = "";
       for (int j = 0; j <= i; j++) {
@@ -43,7 +42,7 @@ void wifiscanSetup() {
       }
       setNeoPixelColour("0");
       
-      u8g2.drawStr(80, 10, dots.c_str()); 
+      DisplayManager::blitText(u8g2, 80, 0, dots.c_str()); 
 
       u8g2.sendBuffer();
       delay(300); 
@@ -89,8 +88,7 @@ void wifiscanLoop() {
 
   if (!isDetailView && isScanComplete) {
     u8g2.clearBuffer();
-    u8g2.setFont(u8g2_font_5x8_tr);
-    u8g2.drawStr(0, 10, "Wi-Fi Networks:");
+    DisplayManager::blitText(u8g2, 0, 0, "Wi-Fi Networks:");
 
     int networkCount = WiFi.scanComplete();
     for (int i = 0; i < 5; i++) {
@@ -101,14 +99,15 @@ void wifiscanLoop() {
       int rssi = WiFi.RSSI(currentNetworkIndex);
 
       String networkInfo = networkName.substring(0, 7);
-      String networkrssi = " | RSSI " + String(rssi);
-      u8g2.setFont(u8g2_font_6x10_tr);
+      String networkrssi = "| RSSI " + String(rssi);
 
+      // Uma rede por página (8 px), a partir da página 2
+      int y = 16 + i * 8;
       if (currentNetworkIndex == currentIndex) {
-        u8g2.drawStr(0, 23 + i * 10, ">");
+        DisplayManager::blitText(u8g2, 0, y, ">");
       }
-      u8g2.drawStr(10, 23 + i * 10, networkInfo.c_str());
-      u8g2.drawStr(50, 23 + i * 10, networkrssi.c_str());
+      DisplayManager::blitText(u8g2, 10, y, networkInfo.c_str());
+      DisplayManager::blitText(u8g2, 56, y, networkrssi.c_str());
     }
     u8g2.sendBuffer();
   }
@@ -120,20 +119,19 @@ void wifiscanLoop() {
     int channel = WiFi.channel(currentIndex);
 
     u8g2.clearBuffer();
-    u8g2.setFont(u8g2_font_6x10_tr);
-    u8g2.drawStr(0, 10, "Network Details:");
+    DisplayManager::blitText(u8g2, 0, 0, "Network Details:");
 
-    u8g2.setFont(u8g2_font_5x8_tr);
     String name = "SSID: " + networkName;
-    String bssid = "BSSID: " + networkBSSID;
     String signal = "RSSI: " + String(rssi);
     String ch = "Channel: " + String(channel);
 
-    u8g2.drawStr(0, 20, name.c_str());
-    u8g2.drawStr(0, 30, bssid.c_str());
-    u8g2.drawStr(0, 40, signal.c_str());
-    u8g2.drawStr(0, 50, ch.c_str());
-    u8g2.drawStr(0, 60, "Press LEFT to go back");
+    // Cabem 21 glifos por linha: o BSSID (17) fica sozinho na página abaixo do rótulo
+    DisplayManager::blitText(u8g2, 0, 16, name.c_str());
+    DisplayManager::blitText(u8g2, 0, 24, "BSSID:");
+    DisplayManager::blitText(u8g2, 0, 32, networkBSSID.c_str());
+    DisplayManager::blitText(u8g2, 0, 40, signal.c_str());
+    DisplayManager::blitText(u8g2, 0, 48, ch.c_str());
+    DisplayManager::blitText(u8g2, 0, 56, "Press LEFT to go back");
     u8g2.sendBuffer();
 
     if (digitalRead(BTN_PIN_LEFT) == LOW) {
@@ -143,7 +141,9 @@ void wifiscanLoop() {
     }
   }
 }
+#endif // FEATURE_WIFI_RX
 
+#if FEATURE_WIFI_TX
 namespace Deauther {
 
 const int networks_per_page = 5;
@@ -214,22 +214,19 @@ int compare_ap(const void *a, const void *b) {
 
 void drawScanScreen() {
     u8g2.clearBuffer();
-    u8g2.setFont(u8g2_font_5x8_tr);
-    u8g2.drawStr(0, 10, "Wi-Fi Networks:");
+    DisplayManager::blitText(u8g2, 0, 0, "Wi-Fi Networks:");
     
     if (scanning) {
 
-    u8g2.setFont(u8g2_font_6x10_tr);
     for (int cycle = 0; cycle < 3; cycle++) {
         for (int i = 0; i < 3; i++) {
             u8g2.clearBuffer();
-            u8g2.drawStr(0, 10, "Scanning WiFi");
+            DisplayManager::blitText(u8g2, 0, 0, "Scanning WiFi");
             String dots = "";
             for (int j = 0; j <= i; j++) {
                 dots += ".";
             }
-            u8g2.setFont(u8g2_font_6x10_tr);
-            u8g2.drawStr(80, 10, dots.c_str());
+            DisplayManager::blitText(u8g2, 80, 0, dots.c_str());
             setNeoPixelColour("white");
             u8g2.sendBuffer();
             delay(300);
@@ -244,9 +241,8 @@ void drawScanScreen() {
     }
 
     if (network_count == 0) {
-        u8g2.drawStr(10, 30, "No networks found.");
+        DisplayManager::blitText(u8g2, 10, 24, "No networks found.");
     } else {
-      u8g2.setFont(u8g2_font_6x10_tr);
         for (int i = 0; i < networks_per_page; i++) {
             int currentNetworkIndex = i + listStartIndex;
             if (currentNetworkIndex >= network_count) break;
@@ -255,13 +251,14 @@ void drawScanScreen() {
             int rssi = ap_list[currentNetworkIndex].rssi;
 
             String networkInfo = networkName.substring(0, 7);
-            String networkRssi = " | RSSI " + String(rssi);
+            String networkRssi = "| RSSI " + String(rssi);
 
+            int y = 16 + i * 8;
             if (currentNetworkIndex == currentIndex) {
-                u8g2.drawStr(0, 23 + i * 10, ">");
+                DisplayManager::blitText(u8g2, 0, y, ">");
             }
-            u8g2.drawStr(10, 23 + i * 10, networkInfo.c_str());
-            u8g2.drawStr(50, 23 + i * 10, networkRssi.c_str());
+            DisplayManager::blitText(u8g2, 10, y, networkInfo.c_str());
+            DisplayManager::blitText(u8g2, 56, y, networkRssi.c_str());
         }
     }
 
@@ -347,9 +344,7 @@ void resetWifi() {
 void drawAttackScreen(bool fullRedraw = true) {
     if (fullRedraw) {
         u8g2.clearBuffer();
-        u8g2.setFont(u8g2_font_6x10_tr);
-        u8g2.drawStr(0, 10, "Network Details:");
-        u8g2.setFont(u8g2_font_5x8_tr);
+        DisplayManager::blitText(u8g2, 0, 0, "Network Details:");
 
         static String name = "";
         static String bssid = "";
@@ -380,17 +375,13 @@ void drawAttackScreen(bool fullRedraw = true) {
             authStr = "Auth: " + auth;
         }
 
-        u8g2.drawStr(0, 20, name.c_str());
-        //u8g2.drawStr(0, 28, bssid.c_str());
-        //u8g2.drawStr(0, 28, signal.c_str());
-        //u8g2.drawStr(50, 28, ch.c_str());
-        u8g2.drawStr(0, 30, authStr.c_str());
-        u8g2.drawStr(0, 63, "Press RIGHT to Start");
+        DisplayManager::blitText(u8g2, 0, 16, name.c_str());
+        DisplayManager::blitText(u8g2, 0, 24, authStr.c_str());
+        DisplayManager::blitText(u8g2, 0, 56, "Press RIGHT to Start");
     } else {
-        u8g2.setFont(u8g2_font_5x8_tr);
+        // Apaga só as páginas dos contadores: um valor mais curto não deixa sobras
         u8g2.setDrawColor(0);
-        u8g2.drawBox(0, 60, 128, 8); 
-        u8g2.drawBox(0, 68, 128, 8); 
+        u8g2.drawBox(0, 32, 128, 24);
         u8g2.setDrawColor(1);
     }
 
@@ -399,10 +390,9 @@ void drawAttackScreen(bool fullRedraw = true) {
     float success_rate = (packet_count > 0) ? (float)success_count / packet_count * 100 : 0;
     String success = "Succ: " + String(success_rate, 0) + "%";
 
-    u8g2.drawStr(0, 40, status.c_str());
-    u8g2.drawStr(84, 40, packets.c_str());
-    u8g2.drawStr(0, 50, success.c_str());
-    u8g2.drawStr(0, 63, "Press RIGHT to Start");
+    DisplayManager::blitText(u8g2, 0, 32, status.c_str());
+    DisplayManager::blitText(u8g2, 0, 40, packets.c_str());
+    DisplayManager::blitText(u8g2, 0, 48, success.c_str());
 
     setNeoPixelColour(attack_running ? "orange" : "0");
     u8g2.sendBuffer();
@@ -476,7 +466,7 @@ void handleButtons() {
 
 void deautherSetup() {
     Serial.begin(115200);
-    u8g2.begin();
+    // O display já foi iniciado pelo DisplayManager; um novo begin() desfaria o brilho salvo
 
     pinMode(BUTTON_UP_PIN, INPUT_PULLUP);
     pinMode(BUTTON_DOWN_PIN, INPUT_PULLUP);
@@ -582,3 +572,4 @@ void deautherLoop() {
     }
   }
 } 
+#endif // FEATURE_WIFI_TX